@@ -32,6 +32,7 @@ struct InVertexAssembly
     EIS_TEXCOORD1 float2 TexCoord1 : TEXCOORD1;
     EIS_TEXCOORD2 float2 TexCoord2 : TEXCOORD2;
     EIS_TEXCOORD3 float2 TexCoord3 : TEXCOORD3;
+    uint InstanceId : SV_InstanceID;
 };
 
 struct InPixelAssembly
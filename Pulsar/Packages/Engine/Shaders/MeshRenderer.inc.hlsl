@@ -30,7 +30,16 @@ struct LightShaderParameter
 
 StructuredBuffer<LightShaderParameter> LightDataBuffer : register(b0, space2);
 
-ConstantBuffer<PerObjectCBufferStruct> PerObjectBuffer : register(b0, space3);
+// one element per instance, non-instanced draws use a single element
+StructuredBuffer<PerObjectCBufferStruct> PerObjectBuffers : register(b0, space3);
+
+static uint PerObjectInstanceId;
+#define PerObjectBuffer PerObjectBuffers[PerObjectInstanceId]
+
+inline void SetupPerObject(InVertexAssembly a2v)
+{
+    PerObjectInstanceId = a2v.InstanceId;
+}
 
 
 
@@ -9,6 +9,7 @@ void SurfaceVertexMain(inout InPixelAssembly v2f);
 
 InPixelAssembly main(InVertexAssembly a2v)
 {
+    SetupPerObject(a2v);
     InPixelAssembly v2f = (InPixelAssembly) 0;
     v2f.WorldNormal = ObjectNormalToWorld(a2v.Normal);
     v2f.TexCoord0 = a2v.TexCoord0;
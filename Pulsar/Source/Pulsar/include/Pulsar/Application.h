@@ -7,6 +7,8 @@
 
 namespace pulsar
 {
+    class JobSystem;
+
     class Application
     {
     private:
@@ -14,6 +16,7 @@ namespace pulsar
     public:
         static AppInstance* inst();
         static gfx::GFXApplication* GetGfxApp();
+        static JobSystem* GetJobSystem();
         //start
         static int Exec(AppInstance* instance, string_view title, Vector2f size);
         
@@ -1,16 +1,66 @@
 #pragma once
 #include <Pulsar/AssetObject.h>
+#include <atomic>
+#include <mutex>
 
 namespace pulsar
 {
+    enum class AssetLoadPriority : uint8_t
+    {
+        Low,
+        Normal,
+        High,
+    };
+
+    enum class AssetLoadStatus : uint8_t
+    {
+        Queued,
+        Loading,
+        // deserialized, waiting for its gpu resource on the main thread
+        Uploading,
+        Completed,
+        Failed,
+        Cancelled,
+    };
+
+    // state of one async load, shared between the caller and the asset manager
+    class AssetLoadRequest
+    {
+    public:
+        AssetLoadStatus GetStatus() const { return Status.load(std::memory_order_acquire); }
+        bool IsDone() const { return GetStatus() >= AssetLoadStatus::Completed; }
+        // valid once the status is Completed
+        const RCPtr<AssetObject>& GetAsset() const { return Asset; }
+        // a request that already completed keeps its asset
+        void Cancel() { IsCancelled.store(true, std::memory_order_release); }
+
+        string Path;
+        ObjectHandle Handle;
+        AssetLoadPriority Priority = AssetLoadPriority::Normal;
+        // called on the main thread when the request is done, whatever the status
+        std::function<void(AssetLoadRequest&)> OnDone;
+
+        std::atomic<AssetLoadStatus> Status{AssetLoadStatus::Queued};
+        std::atomic<bool> IsCancelled{false};
+        RCPtr<AssetObject> Asset;
+    };
+    using AssetLoadHandle = std::shared_ptr<AssetLoadRequest>;
 
     class AssetManager
     {
     public:
         virtual RCPtr<AssetObject> LoadAssetAtPath(string_view path) = 0;
-        
+
         virtual RCPtr<AssetObject> LoadAssetById(ObjectHandle id) = 0;
 
+        // loads synchronously unless overridden, the request still completes in the next Tick
+        // so an OnDone set after the call is called
+        virtual AssetLoadHandle LoadAssetAsync(string_view path, AssetLoadPriority priority = AssetLoadPriority::Normal);
+        virtual AssetLoadHandle LoadAssetAsync(ObjectHandle id, AssetLoadPriority priority = AssetLoadPriority::Normal);
+
+        // main thread, finishes async loads
+        virtual void Tick();
+
         template<baseof_assetobject T>
         inline RCPtr<T> LoadAsset(string_view path, bool allowException = false)
         {
@@ -25,6 +75,10 @@ namespace pulsar
 
 
         virtual ~AssetManager() = default;
+    private:
+        std::mutex m_loadedRequestsMutex;
+        // loaded by the base LoadAssetAsync, completed by Tick
+        array_list<AssetLoadHandle> m_loadedRequests;
     };
 
     AssetManager* GetAssetManager();
@@ -38,4 +92,4 @@ namespace pulsar
         }
     }
 
-}
\ No newline at end of file
+}
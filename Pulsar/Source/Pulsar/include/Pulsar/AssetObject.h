@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Pulsar/ObjectBase.h>
+#include <Pulsar/Util/MappedFile.h>
 #include <CoreLib/Guid.h>
 #include <CoreLib/sser.hpp>
 #include <CoreLib.Serialization/DataSerializer.h>
@@ -43,8 +44,12 @@ namespace pulsar
     public:
         ser::VarientRef Object;
         std::iostream& Stream;
-        OSPlatform Platform;
-        bool CookedOnly;
+        OSPlatform Platform{};
+        // object data is msgpack and editor only data is stripped, see CookedAssetPackage
+        bool CookedOnly = false;
+        // cooked reads only, the bulk data of the asset in the mapped package.
+        // Stream reads the same bytes, assets may keep views into it instead of copying
+        BulkDataView MappedBulkData;
         bool ExistStream;
         const bool IsWrite;
         const bool HasEditorData;
@@ -37,7 +37,8 @@ namespace pulsar
         friend class StaticMeshAssetSerializer;
         CORELIB_DEF_TYPE(AssemblyObject_pulsar, pulsar::StaticMesh, Mesh)
     public:
-        constexpr static int32_t SerializeVersion = 1;
+        // 2: sections are written with sser::ReadWriteBulk
+        constexpr static int32_t SerializeVersion = 2;
         StaticMesh() = default;
         ~StaticMesh() override;
     public:
@@ -53,10 +54,12 @@ namespace pulsar
         void CalcBounds();
     protected:
         virtual void OnInstantiateAsset(AssetObject* obj) override;
+        void SerializeCookedSections(AssetSerializer* s);
     public:
         // Override
         virtual size_t GetVertexCount() override { return 0; }
 
+        // empty for cooked meshes read from a mapped package, their data only goes to the gpu
         StaticMeshSection& GetMeshSection(int i) { return m_sections[i]; }
         size_t GetMeshSectionCount() const { return m_sections.size(); }
         const array_list<string>& GetMaterialNames() const { return m_materialNames; }
@@ -73,6 +76,17 @@ namespace pulsar
         array_list<StaticMeshSection> m_sections;
         array_list<string> m_materialNames;
     protected: // runtime data
+        struct MappedSection
+        {
+            BulkDataView Vertex;
+            BulkDataView Indices;
+            uint32_t VertexCount;
+            uint32_t IndexCount;
+            int32_t MaterialIndex;
+        };
+        // views into the mapped cooked package, uploaded without a heap copy
+        array_list<MappedSection> m_mappedSections;
+
         bool m_isCreatedResource = false;
         array_list<gfx::GFXBuffer_sp> m_vertexBuffers;
         array_list<gfx::GFXBuffer_sp> m_indicesBuffers;
@@ -52,6 +52,12 @@ namespace pulsar
         bool IsCreatedGPUResource() const override;
 
         std::shared_ptr<gfx::GFXTexture> GetGFXTexture() const override { return m_tex; }
+    protected:
+#ifdef WITH_EDITOR
+        // origin image converted to the gpu format of the compression setting
+        array_list<uint8_t> CompressNativeData();
+#endif
+        void SerializeCooked(AssetSerializer* s);
 
     public:
         bool IsSRGB() const { return m_isSRGB; }
@@ -66,6 +72,9 @@ namespace pulsar
         bool m_isSRGB;
 
         array_list<uint8_t> m_originMemory;
+        // cooked gpu format data, a view into the mapped package or into m_nativeMemory
+        BulkDataView m_nativeData;
+        array_list<uint8_t> m_nativeMemory;
         bool m_compressedOriginImage = false;
         bool m_loadedOriginMemory = false;
         size_t m_cachedUncompressedRawSize{};
@@ -0,0 +1,28 @@
+#pragma once
+#include "ObjectBase.h"
+#include <functional>
+
+namespace pulsar
+{
+    class Component;
+
+    // begun components of a world bucketed by component type id
+    class ComponentManager
+    {
+    public:
+        void Add(Component* component);
+        void Remove(Component* component);
+
+        // components of the type and of its subclasses, func must not begin or end components
+        void ForEach(Type* type, const std::function<void(Component*)>& func) const;
+        template<typename T>
+        void ForEach(const std::function<void(T*)>& func) const
+        {
+            ForEach(cltypeof<T>(), [&](Component* component) { func(static_cast<T*>(component)); });
+        }
+        size_t GetCount(Type* type) const;
+
+    protected:
+        array_list<array_list<Component*>> m_components;
+    };
+}
@@ -7,6 +7,8 @@
 #include <Pulsar/EngineMath.h>
 #include <Pulsar/ObjectBase.h>
 #include <Pulsar/Ticker.h>
+#include <Pulsar/Components/ComponentTypeRegistry.h>
+#include <Pulsar/TickManager.h>
 
 namespace pulsar
 {
@@ -59,6 +61,8 @@ namespace pulsar
     class Component : public SceneObject, public ITickable
     {
         friend class Node;
+        friend class ComponentManager;
+        friend class TickManager;
         CORELIB_DEF_TYPE(AssemblyObject_pulsar, pulsar::Component, SceneObject);
         CORELIB_CLASS_ATTR(new AbstractComponentAttribute);
     public:
@@ -69,6 +73,7 @@ namespace pulsar
         World* GetWorld() const;
         ObjectPtr<Scene> GetRuntimeScene() const;
         TransformComponent* GetTransform() const;
+        const ComponentTypeInfo* GetComponentTypeInfo() const { return m_componentTypeInfo; }
         array_list<ObjectHandle> GetReferenceHandles() const;
         void SendMessage(MessageId msgid);
         virtual BoxSphereBounds3f GetBoundsWS() { return {}; }
@@ -77,6 +82,9 @@ namespace pulsar
         virtual void OnTransformChanged() {}
 
         bool CanDrawGizmo() const { return m_canDrawGizmo; }
+        // only components that set m_canTick get OnTick calls
+        bool CanTick() const { return m_canTick; }
+        TickGroup GetTickGroup() const { return m_tickGroup; }
         virtual void OnDrawGizmo(GizmoPainter* painter, bool selected) {}
     protected:
         virtual void OnReceiveMessage(MessageId id);
@@ -102,9 +110,20 @@ namespace pulsar
         ObjectPtr<Node> m_ownerNode;
         Node* m_ownerNodePtr = nullptr;
         ObjectPtr<Scene> m_runtimeScene;
+        const ComponentTypeInfo* m_componentTypeInfo = nullptr;
+        static constexpr uint32_t kInvalidManagerIndex = UINT32_MAX;
+        uint32_t m_componentManagerIndex = kInvalidManagerIndex;
+        static constexpr uint32_t kInvalidTickIndex = UINT32_MAX;
+        uint32_t m_tickIndex = kInvalidTickIndex;
     protected:
         bool m_beginning = false;
         bool m_canDrawGizmo = false;
+        bool m_canTick = false;
+        // set with m_canTick, they are read once when the component begins.
+        // the defaults run the tick alone on the main thread
+        TickGroup  m_tickGroup = TickGroup::PrePhysics;
+        TickAccess m_tickReads = TickAccess::All;
+        TickAccess m_tickWrites = TickAccess::All;
     public:
         bool IsCollapsing = false;
     };
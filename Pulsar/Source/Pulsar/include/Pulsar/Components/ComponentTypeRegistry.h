@@ -0,0 +1,39 @@
+#pragma once
+#include <CoreLib/Type.h>
+#include <cstdint>
+
+namespace pulsar
+{
+    using namespace jxcorlib;
+
+    struct ComponentTypeInfo
+    {
+        Type* ComponentType;
+        uint32_t Id;
+
+        // constant time through the ancestor table of the type
+        bool IsSubclassOf(const ComponentTypeInfo* base) const
+        {
+            return ComponentType->IsSubclassOf(base->ComponentType);
+        }
+    };
+
+    // dense ids for component types, assigned on first use. the returned infos are immutable
+    // and live for the whole program, so they can be read from any thread without locking.
+    class ComponentTypeRegistry final
+    {
+    public:
+        // null if the type is not a component type
+        static const ComponentTypeInfo* GetInfo(Type* type);
+        // resolved once per T, later calls take no lock
+        template<typename T>
+        static const ComponentTypeInfo* GetInfo()
+        {
+            static const ComponentTypeInfo* info = GetInfo(cltypeof<T>());
+            return info;
+        }
+        // ids of the type and of all its registered subclasses
+        static void GetDerivedIds(const ComponentTypeInfo* info, array_list<uint32_t>& out);
+        static uint32_t GetCount();
+    };
+}
@@ -1,5 +1,7 @@
 #pragma once
 #include "SceneCaptureComponent.h"
+#include <Pulsar/Rendering/ViewCulling.h>
+#include <gfx/GFXCommandBuffer.h>
 
 namespace pulsar
 {
@@ -16,6 +18,7 @@ namespace pulsar
 
         Matrix4f GetViewMat() const;
         Matrix4f GetProjectionMat() const;
+        Matrix4f GetViewProjectionMat() const;
         Matrix4f GetInvViewProjectionMat() const;
 
         float GetFOV() const { return m_fov; }
@@ -32,6 +35,17 @@ namespace pulsar
         float GetOrthoSize() const { return m_orthoSize; }
         void SetOrthoSize(float value);
 
+        // zero means unlimited
+        float GetMaxDrawDistance() const { return m_maxDrawDistance; }
+        void  SetMaxDrawDistance(float value) { m_maxDrawDistance = value; }
+
+        const rendering::ViewCullingStats& GetCullingStats() const { return m_cullingStats; }
+        void SetCullingStats(const rendering::ViewCullingStats& stats) { m_cullingStats = stats; }
+
+        // binds and draws recorded for this capture in the last frame
+        const gfx::GFXCommandBufferStats& GetRenderStats() const { return m_renderStats; }
+        void SetRenderStats(const gfx::GFXCommandBufferStats& stats) { m_renderStats = stats; }
+
         void OnTransformChanged() override;
 
     protected:
@@ -67,6 +81,9 @@ namespace pulsar
         CORELIB_REFL_DECL_FIELD(m_renderingPath);
         RenderingPathMode m_renderingPath;
 
+        CORELIB_REFL_DECL_FIELD(m_maxDrawDistance);
+        float m_maxDrawDistance{};
+
         bool m_managedRT{false};
         #ifdef WITH_EDITOR
         CORELIB_REFL_DECL_FIELD(m_debugViewMat, new DebugPropertyAttribute, new ReadOnlyPropertyAttribute);
@@ -76,6 +93,8 @@ namespace pulsar
     protected:
 
         RenderTargetShaderParameter m_targetBuffer{};
+        rendering::ViewCullingStats m_cullingStats{};
+        gfx::GFXCommandBufferStats m_renderStats{};
 
         RCPtr<RenderTexture> m_sceneColor;
     };
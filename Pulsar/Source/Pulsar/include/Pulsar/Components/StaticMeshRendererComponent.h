@@ -50,6 +50,9 @@ namespace pulsar
 
         int32_t GetRenderQueuePriority() const { return m_renderQueuePriority; }
         void SetRenderQueuePriority(int32_t value) { m_renderQueuePriority = value; }
+
+        bool IsInstancing() const { return m_isInstancing; }
+        void SetInstancing(bool value);
     protected:
         void OnDependencyMessage(ObjectHandle inDependency, DependencyObjectState msg) override;
         void ResizeMaterials(size_t size);
@@ -57,6 +60,7 @@ namespace pulsar
         // void EndListenMaterialStateChanged(size_t index);
         void OnMaterialStateChanged();
         void OnTransformChanged() override;
+        void UpdateRenderObjectBounds();
         void OnMeshChanged();
         void OnMaterialChanged();
     protected:
@@ -77,6 +81,10 @@ namespace pulsar
         CORELIB_REFL_DECL_FIELD(m_boundsScale, new RangePropertyAttribute(0.1f, 10.f));
         float m_boundsScale = 1;
 
+        // draw together with other renderers of the same mesh and material in one instanced call
+        CORELIB_REFL_DECL_FIELD(m_isInstancing);
+        bool m_isInstancing = false;
+
         SPtr<StaticMeshRenderObject> m_renderObject;
 
     private:
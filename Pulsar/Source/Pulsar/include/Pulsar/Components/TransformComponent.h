@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Component.h"
+#include <Pulsar/TransformManager.h>
 
 namespace pulsar
 {
@@ -11,6 +12,7 @@ namespace pulsar
     };
     class TransformComponent : public Component
     {
+        friend class TransformManager;
         CORELIB_DEF_TYPE(AssemblyObject_pulsar, pulsar::TransformComponent, Component);
         CORELIB_CLASS_ATTR(new AbstractComponentAttribute);
     public:
@@ -51,13 +53,13 @@ namespace pulsar
 
         TransformComponent();
         void BeginComponent() override;
+        void EndComponent() override;
 
         const Matrix4f& GetParentLocalToWorldMatrix();
         const Matrix4f& GetParentWorldToLocalMatrix();
         const Matrix4f& GetLocalToWorldMatrix();
         const Matrix4f& GetWorldToLocalMatrix();
     protected:
-        void OnTransformChanged() override;
         void RebuildLocalToWorldMatrix();
         void PostEditChange(FieldInfo* info) override;
     public:
@@ -68,6 +70,10 @@ namespace pulsar
         Matrix4f m_worldToLocalMatrix;
         bool m_isDirtyMatrix = false;
 
+        // the world store owns the matrices while the component is active
+        TransformManager* m_transformManager = nullptr;
+        uint32_t m_transformHandle = TransformManager::kInvalidHandle;
+
         CORELIB_REFL_DECL_FIELD(m_position);
         Vector3f m_position{};
         CORELIB_REFL_DECL_FIELD(m_euler);
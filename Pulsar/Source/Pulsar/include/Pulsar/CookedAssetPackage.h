@@ -0,0 +1,162 @@
+#pragma once
+#include "AssetManager.h"
+#include "Util/MappedFile.h"
+#include <psc/BinaryFileHeader.h>
+#include "JobSystem.h"
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+
+namespace pulsar
+{
+    // a cooked package holds the object data and the bulk data of many assets in one binf container.
+    // object data is msgpack encoded, loading a cooked asset does no text parsing.
+    constexpr char kCookedPackageMagic[8] = "plsrpkg";
+    constexpr uint32_t kCookedPackageVersion = 2;
+    constexpr const char* kCookedPackageExt = ".pcp";
+
+    enum class CookedResourceType : uint32_t
+    {
+        Index,
+        ObjectData,
+        BulkData,
+    };
+
+    struct CookedAssetInfo
+    {
+        static constexpr uint32_t kNoResource = UINT32_MAX;
+
+        ObjectHandle Handle;
+        string Path;
+        string TypeName;
+        uint32_t ObjectResource = kNoResource;
+        uint32_t BulkResource = kNoResource;
+    };
+
+    // the data of a cooked asset read and parsed, ready to be deserialized into the object
+    struct CookedAssetData
+    {
+        ser::VarientRef Object;
+        BulkDataView Bulk;
+    };
+
+    class CookedAssetPackageWriter
+    {
+    public:
+        // serializes the asset the cooked way, without editor data
+        void AddAsset(AssetObject* asset, string_view path);
+        void Write(std::ostream& stream) const;
+
+        size_t GetAssetCount() const { return m_assets.size(); }
+    protected:
+        struct Resource
+        {
+            CookedResourceType Type;
+            ObjectHandle Handle;
+            string Data;
+        };
+        uint32_t AddResource(CookedResourceType type, ObjectHandle handle, string data);
+
+        array_list<CookedAssetInfo> m_assets;
+        array_list<Resource> m_resources;
+    };
+
+    class CookedAssetPackage
+    {
+    public:
+        // maps the package and reads the index, asset data is only touched on load
+        static std::unique_ptr<CookedAssetPackage> Open(const std::filesystem::path& path);
+
+        const CookedAssetInfo* FindAsset(string_view path) const;
+        const CookedAssetInfo* FindAsset(ObjectHandle handle) const;
+        const array_list<CookedAssetInfo>& GetAssets() const { return m_assets; }
+
+        RCPtr<AssetObject> LoadAsset(const CookedAssetInfo& info);
+        // thread safe, touches no object
+        CookedAssetData ReadAsset(const CookedAssetInfo& info) const;
+        // constructs the object and deserializes the data into it, the object is visible from then on
+        RCPtr<AssetObject> LoadAsset(const CookedAssetInfo& info, const CookedAssetData& data);
+    protected:
+        BulkDataView GetResource(uint32_t index) const;
+        // false with the error logged when an entry is incomplete or out of range, throws when the index does not parse
+        bool ReadIndex(const std::filesystem::path& path);
+
+        std::shared_ptr<MappedFile> m_file;
+        uint64_t m_dataOffset = 0;
+        const binf::BinaryResourceInfo* m_resources = nullptr;
+        size_t m_resourceCount = 0;
+        array_list<CookedAssetInfo> m_assets;
+        hash_map<string, size_t> m_pathIndices;
+        hash_map<ObjectHandle, size_t> m_handleIndices;
+    };
+
+    // runtime asset manager, loads from the mounted cooked packages.
+    // async loads are read and parsed on the job system in priority order. the objects are constructed,
+    // deserialized and get their gpu resources in Tick on the main thread, no other thread sees them half loaded.
+    class CookedAssetManager : public AssetManager
+    {
+    public:
+        ~CookedAssetManager() override;
+
+        // packages are not guarded, mount before loading
+        bool Mount(const std::filesystem::path& path);
+        // mounts every cooked package in the folder
+        void MountFolder(const std::filesystem::path& folder);
+
+        RCPtr<AssetObject> LoadAssetAtPath(string_view path) override;
+        RCPtr<AssetObject> LoadAssetById(ObjectHandle id) override;
+
+        AssetLoadHandle LoadAssetAsync(string_view path, AssetLoadPriority priority = AssetLoadPriority::Normal) override;
+        AssetLoadHandle LoadAssetAsync(ObjectHandle id, AssetLoadPriority priority = AssetLoadPriority::Normal) override;
+
+        void Tick() override;
+
+        // microseconds of object construction and gpu resource creation per Tick, 0 finishes every waiting upload
+        void SetUploadBudget(uint32_t microseconds) { m_uploadBudget = microseconds; }
+        uint32_t GetUploadBudget() const { return m_uploadBudget; }
+        size_t GetPendingCount();
+    protected:
+        // one loader per asset, concurrent loads of it wait for the first
+        struct LoadState
+        {
+            std::mutex Mutex;
+            RCPtr<AssetObject> Asset;
+            bool IsLoaded = false;
+        };
+        struct QueuedRequest
+        {
+            AssetLoadHandle Request;
+            uint64_t Sequence;
+        };
+        // a request read on the job system, finished by Tick
+        struct Upload
+        {
+            AssetLoadHandle Request;
+            CookedAssetPackage* Package = nullptr;
+            const CookedAssetInfo* Info = nullptr;
+            // empty when the asset was loaded already or could not be read
+            std::optional<CookedAssetData> Data;
+        };
+
+        RCPtr<AssetObject> Load(CookedAssetPackage* package, const CookedAssetInfo& info, const CookedAssetData* data = nullptr);
+        bool FindAsset(const AssetLoadRequest& request, CookedAssetPackage*& package, const CookedAssetInfo*& info) const;
+        void Enqueue(AssetLoadHandle request);
+        void RunNext();
+        Upload ProcessRequest(AssetLoadHandle request);
+        void FinishUpload(Upload& upload);
+
+        array_list<std::unique_ptr<CookedAssetPackage>> m_packages;
+
+        std::mutex m_mutex;
+        hash_map<ObjectHandle, std::shared_ptr<LoadState>> m_loading;
+        // heap, highest priority first and fifo within a priority
+        array_list<QueuedRequest> m_queue;
+        uint64_t m_sequence = 0;
+        // read, failed or cancelled, finished by Tick
+        std::deque<Upload> m_uploads;
+
+        JobCounter m_jobs;
+        uint32_t m_uploadBudget = 2000;
+    };
+}
@@ -1,6 +1,9 @@
 #pragma once
 #include "AppInstance.h"
+#include "CookedAssetPackage.h"
 #include "Components/SceneCaptureComponent.h"
+#include <gfx-null/GFXNullStatistics.h>
+#include <optional>
 
 namespace pulsar
 {
@@ -22,6 +25,8 @@ namespace pulsar
 
     protected:
         array_list<World*> m_worlds;
+        uint32_t m_cullingViewId{};
+        gfx::GFXDescriptorSetLayout_sp m_postProcessDescLayout;
     };
 
 
@@ -46,6 +51,27 @@ namespace pulsar
 
         virtual void OnEndRender(float d4) override;
 
+        // run on the null gfx backend without a window, frameCount 0 runs until quit
+        void SetHeadless(uint32_t frameCount)
+        {
+            m_isHeadless = true;
+            m_headlessFrameCount = frameCount;
+        }
+        // fail the headless run when its second half creates gfx objects or binds more per frame
+        // than the first half, so regression runs catch a growing cpu render cost
+        void SetCheckHeadlessStats(bool check) { m_checkHeadlessStats = check; }
+        // false once a requested check has failed, known after OnTerminate
+        bool IsHeadlessStatsPassed() const { return m_headlessStatsPassed; }
+    protected:
+        void CheckHeadlessStats();
+
+        bool m_isHeadless = false;
+        uint32_t m_headlessFrameCount = 0;
+        bool m_checkHeadlessStats = false;
+        bool m_headlessStatsPassed = true;
+        // taken halfway through the run
+        std::optional<gfx::GFXNullStatistics> m_headlessHalfStats;
+        std::unique_ptr<CookedAssetManager> m_assetManager;
     };
 
 }
\ No newline at end of file
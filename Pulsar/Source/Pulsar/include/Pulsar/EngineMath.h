@@ -98,5 +98,6 @@ namespace pulsar
     using math::BoxBounds3f;
     using math::BoxSphereBounds3f;
     using math::SphereBounds3f;
+    using math::Frustum3f;
     using math::Triangle3f;
 }
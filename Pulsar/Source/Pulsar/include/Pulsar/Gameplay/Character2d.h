@@ -10,6 +10,7 @@ namespace pulsar
         CORELIB_DEF_TYPE(AssemblyObject_pulsar, pulsar::Character2d, Component);
         CORELIB_CLASS_ATTR(new CategoryAttribute("2D"))
     public:
+        Character2d();
         void BeginPlay() override;
         void EndPlay() override;
         void OnTick(Ticker ticker) override;
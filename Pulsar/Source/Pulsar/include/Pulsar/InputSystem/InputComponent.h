@@ -40,6 +40,7 @@ namespace pulsar
         CORELIB_CLASS_ATTR(new CategoryAttribute("Input"));
     public:
         using InputEventDelegate = FunctionDelegate<void, SPtr<InputContext>>;
+        InputComponent();
         virtual void Bind(string_view name, SPtr<InputEventDelegate> callback);
 
         void OnTick(Ticker ticker) override;
@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pulsar
+{
+    // counts scheduled jobs that have not finished yet
+    class JobCounter
+    {
+    public:
+        bool IsDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+    private:
+        friend class JobSystem;
+        std::atomic<uint32_t> m_pending{};
+    };
+
+    // fixed pool of worker threads. threads that wait on jobs run queued jobs meanwhile,
+    // so jobs can schedule and wait for other jobs without starving the pool.
+    class JobSystem
+    {
+    public:
+        explicit JobSystem(uint32_t workerCount = GetDefaultWorkerCount());
+        JobSystem(const JobSystem&) = delete;
+        ~JobSystem();
+    public:
+        static uint32_t GetDefaultWorkerCount();
+
+        uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_workers.size()); }
+
+        void Schedule(std::function<void()> job, JobCounter* counter = nullptr);
+        void Wait(JobCounter& counter);
+
+        // runs func(index) for every index in [0, count), the calling thread takes part
+        void ParallelFor(size_t count, const std::function<void(size_t index)>& func);
+    private:
+        struct Job
+        {
+            std::function<void()> Func;
+            JobCounter* Counter;
+        };
+
+        bool TryRunOne();
+        void RunJob(Job& job);
+        void WorkerMain();
+    private:
+        std::vector<std::thread> m_workers;
+
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::deque<Job> m_jobs;
+        bool m_isStopping = false;
+    };
+}
@@ -58,6 +58,7 @@ namespace pulsar
 
         void OnActive();
         void OnInactive();
+        // recomputes the cached hierarchy state after the parent or its active state changed
         void OnParentActiveChanged();
         void OnTransformChanged();
         TransformComponent* GetTransform() const;
@@ -90,7 +91,7 @@ namespace pulsar
         int                  IndexOf(ObjectPtr<Component> component) const;
 
         template<baseof_component_concept T>
-        ObjectPtr<T>         GetComponent() { return this->GetComponent(cltypeof<T>()); }
+        ObjectPtr<T>         GetComponent() { return this->GetComponent(cltypeof<T>(), ComponentTypeRegistry::GetInfo<T>()); }
         ObjectPtr<Component> GetComponent(Type* type) const;
 
         void                                    GetAllComponents(array_list<ObjectPtr<Component>>& list);
@@ -100,9 +101,10 @@ namespace pulsar
         template <baseof_component_concept T>
         void GetComponents(array_list<ObjectPtr<T>>& array) const
         {
+            const auto info = ComponentTypeRegistry::GetInfo<T>();
             for (const auto& item : *this->m_components)
             {
-                if (cltypeof<T>()->IsInstanceOfType(item.GetPtr()))
+                if (IsComponentOf(item.GetPtr(), cltypeof<T>(), info))
                 {
                    array.push_back(item);
                 }
@@ -120,6 +122,16 @@ namespace pulsar
         }
 
     protected:
+        ObjectPtr<Component> GetComponent(Type* type, const ComponentTypeInfo* info) const;
+        // constant time through the type ids, components created outside AddComponent fall back to the type chain
+        static bool IsComponentOf(const Component* component, Type* type, const ComponentTypeInfo* info)
+        {
+            if (component && component->GetComponentTypeInfo() && info)
+            {
+                return component->GetComponentTypeInfo()->IsSubclassOf(info);
+            }
+            return type->IsInstanceOfType(component);
+        }
         void BeginComponent(Component_ref component);
         void EndComponent(Component_ref component);
     public:
@@ -136,6 +148,8 @@ namespace pulsar
         TransformComponent* m_transform = nullptr;
 
         bool m_isInitialized = false;
+        // active self and every parent active, only maintained while the node is in a runtime scene
+        bool m_activeInHierarchy = false;
 
         ObjectPtr<Scene> m_runtimeScene = nullptr;
 
@@ -11,6 +11,9 @@
 #include <Pulsar/EngineMath.h>
 #include <unordered_map>
 #include <unordered_set>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <CoreLib/IndexString.h>
 #include <CoreLib/sser.hpp>
 #include "Assembly.h"
@@ -37,6 +40,19 @@ namespace pulsar
 
     using ObjectHandle = guid_t;
 
+    // in memory identity of an object, a slot index and the generation the slot had when it was handed out.
+    // the guid stays the persistent identity and is looked up through the slot
+    struct RuntimeObjectHandle
+    {
+        static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+
+        uint32_t Index = kInvalidIndex;
+        uint32_t Generation = 0;
+
+        [[always_inline]] bool IsValid() const noexcept { return Index != kInvalidIndex; }
+        bool operator==(const RuntimeObjectHandle&) const noexcept = default;
+    };
+
     template<typename K, typename V>
     using hash_map = std::unordered_map<K, V>;
 
@@ -71,6 +87,7 @@ namespace pulsar
         ~ObjectBase() noexcept override;
     public:
         [[always_inline]] ObjectHandle GetObjectHandle() const noexcept { return this->m_objectHandle; }
+        [[always_inline]] RuntimeObjectHandle GetRuntimeHandle() const noexcept { return this->m_runtimeHandle; }
     public:
         void Construct(ObjectHandle handle = {});
         virtual void PostEditChange(FieldInfo* info);
@@ -96,6 +113,7 @@ namespace pulsar
         // base class 24
         index_string m_name;         // 8
         ObjectHandle m_objectHandle; // 16
+        RuntimeObjectHandle m_runtimeHandle; // 8
     protected:
         ObjectFlags  m_flags{};      // 8
     public:
@@ -103,50 +121,71 @@ namespace pulsar
 
     inline constexpr int kSizeObjectBase = sizeof(ObjectBase);
 
-    struct ManagedPointer
+    struct RuntimeObjectInfo
     {
-        friend class RuntimeObjectManager;
-    private:
+        ObjectHandle Handle;
         ObjectBase* Pointer{};
-        int Counter{};
-    public:
-        int RefCount() const noexcept { return Counter; }
-        void Incref() { ++Counter; }
-        int Decref()
-        {
-            --Counter;
-            return Counter;
-        }
-        [[always_inline]] ObjectBase* Get() const
-        {
-            return Pointer;
-        }
-        void SetEmptyPtr()
-        {
-            Pointer = nullptr;
-        }
+        int RefCount{};
+        int WeakRefCount{};
+        uint32_t Generation{};
     };
 
-    struct RuntimeObjectInfo
+    struct GCollectStats
     {
-        ObjectHandle Handle;
-        ObjectBase* Pointer{};
-        int ManagedCounter{};
+        // objects and slots still waiting
+        size_t Backlog{};
+        // handled by the last pass
+        size_t Processed{};
+        int64_t TimeMicroseconds{};
     };
 
+    enum class ObjectRefKind : uint8_t
+    {
+        // ObjectPtr, keeps the guid on its slot
+        Weak,
+        // RCPtr, also keeps the object alive
+        Strong,
+    };
+
+    // objects live in generational slots. a slot keeps its guid while the object lives or any pointer references it,
+    // so recreating the guid reconnects existing pointers. slots of persistent objects are kept even unreferenced,
+    // slots of destroyed objects and of guids that were only referenced are recycled by the collector once unreferenced.
     class RuntimeObjectManager final
     {
     public:
         static ObjectBase* GetObject(const ObjectHandle& id) noexcept;
+        // lock free, null once the slot was recycled
+        static ObjectBase* GetObject(RuntimeObjectHandle handle) noexcept;
+        static ObjectHandle GetObjectHandle(RuntimeObjectHandle handle) noexcept;
         static SPtr<ObjectBase> GetSharedObject(const ObjectHandle& id) noexcept;
-        static SPtr<ManagedPointer> GetPointer(const ObjectHandle& id) noexcept;
-        static SPtr<ManagedPointer> AddWaitPointer(const ObjectHandle& id);
+        // finds the slot of the guid or reserves one for an object that is created later, counted as ref.
+        // throws EngineException when the table is full
+        static RuntimeObjectHandle GetRuntimeHandle(const ObjectHandle& id, ObjectRefKind ref);
+        static void AddRef(RuntimeObjectHandle handle) noexcept;
+        // returns the remaining count
+        static int ReleaseRef(RuntimeObjectHandle handle) noexcept;
+        // false when the slot was recycled
+        static bool AddWeakRef(RuntimeObjectHandle handle) noexcept;
+        static void ReleaseWeakRef(RuntimeObjectHandle handle) noexcept;
         static bool IsValid(const ObjectHandle& id) noexcept;
-        static void NewInstance(SPtr<ObjectBase>&& managedObj, const ObjectHandle& handle) noexcept;
+        // throws EngineException when the table is full, the object is left unregistered
+        static void NewInstance(SPtr<ObjectBase>&& managedObj, const ObjectHandle& handle);
         static bool DestroyObject(const ObjectHandle& id, bool isForce = false) noexcept;
+        static bool DestroyObject(RuntimeObjectHandle handle, bool isForce = false) noexcept;
         static void GetData(size_t* total, size_t* place, size_t* alive);
         static void Terminate();
+        // destroys deferred objects and recycles slots until the budget is used up
         static void TickGCollect();
+        // everything at once, for example when a level unloads
+        static void DrainGCollect();
+        // microseconds for each collection pass, TickGCollect gives it to the destroy queue and to slot recycling.
+        // 0 drains every pass
+        static void SetGCollectBudget(uint32_t microseconds);
+        static uint32_t GetGCollectBudget();
+        // one budget from now, every collection pass takes its own so a late pass in the frame still makes progress
+        static std::chrono::steady_clock::time_point MakeGCollectDeadline();
+        static GCollectStats GetGCollectStats();
+        static void DeferDestroyObject(RuntimeObjectHandle handle, bool isForce = false);
         static void ForEachObject(const std::function<void(const RuntimeObjectInfo&)>& func);
 
         //<id, type, is_create>
@@ -160,44 +199,104 @@ namespace pulsar
 
 
 
+    // a weak reference, the object may be destroyed but the slot keeps its guid while the pointer lives
     struct ObjectPtrBase
     {
-        ObjectHandle Handle;
-        SPtr<ManagedPointer> ManagedPtr;
+        RuntimeObjectHandle RuntimeHandle;
 
         ObjectPtrBase() = default;
-        ObjectPtrBase(const ObjectPtrBase&) = default;
-        ObjectPtrBase(ObjectPtrBase&&) = default;
-        ObjectPtrBase(const ObjectHandle& handle) : Handle(handle)
+        ObjectPtrBase(const ObjectPtrBase& ptr) noexcept : ObjectPtrBase(ptr.RuntimeHandle)
+        {
+        }
+        ObjectPtrBase(ObjectPtrBase&& ptr) noexcept : RuntimeHandle(ptr.RuntimeHandle)
+        {
+            ptr.RuntimeHandle = {};
+        }
+        ObjectPtrBase(const ObjectHandle& handle)
         {
             if (!handle.is_empty())
             {
-                ManagedPtr = RuntimeObjectManager::GetPointer(handle);
-                if (ManagedPtr == nullptr)
-                {
-                    ManagedPtr = RuntimeObjectManager::AddWaitPointer(handle);
-                }
+                RuntimeHandle = RuntimeObjectManager::GetRuntimeHandle(handle, ObjectRefKind::Weak);
             }
         }
-        ObjectPtrBase& operator=(const ObjectPtrBase&) = default;
-        ObjectPtrBase& operator=(ObjectPtrBase&&) = default;
-
-        [[always_inline]] const ObjectHandle& GetHandle() const
+        explicit ObjectPtrBase(RuntimeObjectHandle handle) noexcept
         {
-            return Handle;
+            if (handle.IsValid() && RuntimeObjectManager::AddWeakRef(handle))
+            {
+                RuntimeHandle = handle;
+            }
         }
-        [[always_inline]] ObjectHandle& GetHandle()
+        ObjectPtrBase& operator=(const ObjectPtrBase& ptr) noexcept
         {
-            return Handle;
+            if (this == &ptr) return *this;
+            ObjectPtrBase copy{ptr};
+            return *this = std::move(copy);
+        }
+        ObjectPtrBase& operator=(ObjectPtrBase&& ptr) noexcept
+        {
+            if (this == &ptr) return *this;
+            Release();
+            RuntimeHandle = ptr.RuntimeHandle;
+            ptr.RuntimeHandle = {};
+            return *this;
+        }
+        ~ObjectPtrBase() noexcept
+        {
+            Release();
+        }
+
+        [[always_inline]] ObjectHandle GetHandle() const
+        {
+            if (RuntimeHandle.IsValid())
+            {
+                return RuntimeObjectManager::GetObjectHandle(RuntimeHandle);
+            }
+            return {};
         }
         [[always_inline]] ObjectBase* GetObjectPointer() const
         {
-            if (ManagedPtr)
+            if (RuntimeHandle.IsValid())
             {
-                return ManagedPtr->Get();
+                return RuntimeObjectManager::GetObject(RuntimeHandle);
             }
             return nullptr;
         }
+    protected:
+        void Release() noexcept
+        {
+            if (RuntimeHandle.IsValid())
+            {
+                RuntimeObjectManager::ReleaseWeakRef(RuntimeHandle);
+                RuntimeHandle = {};
+            }
+        }
+    };
+
+    // objects destroyed later within a time budget, grouped by type so the same destroy code runs back to back
+    class DeferredDestroyQueue
+    {
+    public:
+        void Push(const ObjectPtrBase& object, bool isForce = false);
+        // objects pushed while processing are included
+        size_t Process(std::chrono::steady_clock::time_point deadline);
+        size_t Drain() { return Process(std::chrono::steady_clock::time_point::max()); }
+        size_t GetCount() const;
+        const GCollectStats& GetStats() const { return m_stats; }
+    private:
+        struct Entry
+        {
+            Type* ObjectType;
+            RuntimeObjectHandle Handle;
+            bool IsForce;
+        };
+        mutable std::mutex m_mutex;
+        // pushed since the last batch was taken
+        array_list<Entry> m_entries;
+        // the batch being destroyed, sorted once when taken and read from m_cursor
+        array_list<Entry> m_batch;
+        size_t m_cursor = 0;
+        std::atomic<size_t> m_batchRemaining{};
+        GCollectStats m_stats;
     };
 
     class BoxingObjectPtrBase : public BoxingObject, public IStringify
@@ -223,11 +322,11 @@ namespace pulsar
 
         [[always_inline]] ObjectHandle GetHandle() const noexcept
         {
-            return ptr.Handle;
+            return ptr.GetHandle();
         }
         [[always_inline]] void SetHandle(const ObjectHandle& handle) noexcept
         {
-            ptr.Handle = handle;
+            ptr = handle;
         }
 
         ObjectPtrBase ptr;
@@ -249,14 +348,12 @@ namespace pulsar
         using element_type = T;
 
         using base::base;
-        ObjectPtr(T* ptr) noexcept : base(ptr ? ptr->GetObjectHandle() : ObjectHandle{})
+        ObjectPtr(T* ptr) noexcept : base(ptr ? ptr->GetRuntimeHandle() : RuntimeObjectHandle{})
         {
         }
 
-        ObjectPtr(const ObjectPtrBase& ptr)
+        ObjectPtr(const ObjectPtrBase& ptr) : base(ptr)
         {
-            Handle = ptr.Handle;
-            ManagedPtr = ptr.ManagedPtr;
         }
 
         ObjectPtr(const SPtr<T>& ptr) : ObjectPtr(ptr.get())
@@ -264,17 +361,15 @@ namespace pulsar
         }
 
         template<typename U> requires std::is_base_of_v<T, U>
-        ObjectPtr(const ObjectPtr<U>& derived) noexcept
+        ObjectPtr(const ObjectPtr<U>& derived) noexcept : base(derived)
         {
-            Handle = derived.Handle;
-            ManagedPtr = derived.ManagedPtr;
         }
 
         ObjectPtr() = default;
 
         [[always_inline]] SPtr<T> GetShared() const noexcept
         {
-            return sptr_cast<T>(RuntimeObjectManager::GetSharedObject(Handle));
+            return sptr_cast<T>(RuntimeObjectManager::GetSharedObject(GetHandle()));
         }
         [[always_inline]] T* GetPtr() const noexcept
         {
@@ -289,10 +384,10 @@ namespace pulsar
             }
             return ptr;
         }
-        [[always_inline]] bool operator==(const ObjectPtrBase& r) const noexcept { return Handle == r.Handle; }
+        [[always_inline]] bool operator==(const ObjectPtrBase& r) const noexcept { return RuntimeHandle == r.RuntimeHandle; }
         [[always_inline]] bool operator==(std::nullptr_t) const noexcept { return !IsValid(); }
         template<typename U>
-        bool operator==(const ObjectPtr<U>& r) const noexcept { return Handle == r.Handle; }
+        bool operator==(const ObjectPtr<U>& r) const noexcept { return RuntimeHandle == r.RuntimeHandle; }
 
         [[always_inline]] bool IsValid() const noexcept
         {
@@ -305,8 +400,7 @@ namespace pulsar
 
         void Reset() noexcept
         {
-            Handle = {};
-            ManagedPtr = nullptr;
+            Release();
         }
     };
 
@@ -321,96 +415,84 @@ namespace pulsar
     class RCPtrBase
     {
     public:
-        ObjectHandle Handle;
-        SPtr<ManagedPointer> ManagedPtr;
+        RuntimeObjectHandle RuntimeHandle;
     protected:
         [[always_inline]] void Incref() const noexcept
         {
-            if (ManagedPtr)
+            if (RuntimeHandle.IsValid())
             {
-                ManagedPtr->Incref();
+                RuntimeObjectManager::AddRef(RuntimeHandle);
             }
         }
         [[always_inline]] void Decref()
         {
-            if (ManagedPtr->Decref() == 0)
+            if (RuntimeHandle.IsValid() && RuntimeObjectManager::ReleaseRef(RuntimeHandle) == 0)
             {
-                RuntimeObjectManager::DestroyObject(Handle);
+                RuntimeObjectManager::DestroyObject(RuntimeHandle);
             }
         }
     public:
-        [[always_inline]] ObjectHandle& GetHandle() noexcept
-        {
-            return Handle;
-        }
-        [[always_inline]] const ObjectHandle& GetHandle() const noexcept
+        [[always_inline]] ObjectHandle GetHandle() const noexcept
         {
-            return Handle;
+            if (RuntimeHandle.IsValid())
+            {
+                return RuntimeObjectManager::GetObjectHandle(RuntimeHandle);
+            }
+            return {};
         }
         [[always_inline]] ObjectBase* GetPointer() const noexcept
         {
-            if (ManagedPtr)
+            if (RuntimeHandle.IsValid())
             {
-                return ManagedPtr->Get();
+                return RuntimeObjectManager::GetObject(RuntimeHandle);
             }
             return nullptr;
         }
-        RCPtrBase(const ObjectHandle& handle) : Handle(), ManagedPtr()
+        RCPtrBase(const ObjectHandle& handle)
         {
             if (!handle.is_empty())
             {
-                Handle = handle;
-                ManagedPtr = RuntimeObjectManager::GetPointer(handle);
-                if (!ManagedPtr)
-                {
-                    ManagedPtr = RuntimeObjectManager::AddWaitPointer(handle);
-                }
+                // counted slots are not recycled while the object lives, so the count stays on this slot
+                RuntimeHandle = RuntimeObjectManager::GetRuntimeHandle(handle, ObjectRefKind::Strong);
             }
-            Incref();
         }
-        RCPtrBase() : Handle({}) {}
-        RCPtrBase(const ObjectBase* ptr) : RCPtrBase(ptr ? ptr->GetObjectHandle() : ObjectHandle{})
+        RCPtrBase() = default;
+        RCPtrBase(const ObjectBase* ptr) : RuntimeHandle(ptr ? ptr->GetRuntimeHandle() : RuntimeObjectHandle{})
         {
+            Incref();
         }
-        RCPtrBase(const RCPtrBase& ptr) noexcept : Handle(ptr.Handle), ManagedPtr(ptr.ManagedPtr)
+        RCPtrBase(const RCPtrBase& ptr) noexcept : RuntimeHandle(ptr.RuntimeHandle)
         {
             Incref();
         }
-        RCPtrBase(RCPtrBase&& ptr) noexcept : Handle(ptr.Handle), ManagedPtr(std::move(ptr.ManagedPtr))
+        RCPtrBase(RCPtrBase&& ptr) noexcept : RuntimeHandle(ptr.RuntimeHandle)
         {
-            ptr.ManagedPtr = nullptr;
+            ptr.RuntimeHandle = {};
         }
         RCPtrBase& operator=(const RCPtrBase& ptr) noexcept
         {
             if (this == &ptr) return *this;
-            if (ManagedPtr) Decref();
-            Handle = ptr.Handle;
-            ManagedPtr = ptr.ManagedPtr;
-            if (ManagedPtr) Incref();
+            ptr.Incref();
+            Decref();
+            RuntimeHandle = ptr.RuntimeHandle;
             return *this;
         }
         RCPtrBase& operator=(RCPtrBase&& ptr) noexcept
         {
-            if (ManagedPtr) Decref();
-            Handle = ptr.Handle;
-            ManagedPtr = std::move(ptr.ManagedPtr);
+            if (this == &ptr) return *this;
+            Decref();
+            RuntimeHandle = ptr.RuntimeHandle;
+            ptr.RuntimeHandle = {};
             return *this;
         }
         ~RCPtrBase() noexcept
         {
-            if (ManagedPtr)
-            {
-                Decref();
-            }
+            Decref();
         }
 
         [[always_inline]] bool IsValid() const noexcept
         {
-            if (ManagedPtr == nullptr)
-            {
-                return false;
-            }
-            return ManagedPtr->Get() != nullptr;
+            return GetPointer() != nullptr;
         }
 
         [[always_inline]] explicit operator bool() const noexcept
@@ -420,7 +502,7 @@ namespace pulsar
 
         bool operator==(const RCPtrBase& ptr) const noexcept
         {
-            return Handle == ptr.Handle;
+            return RuntimeHandle == ptr.RuntimeHandle;
         }
 
         bool operator==(std::nullptr_t) const noexcept
@@ -431,8 +513,7 @@ namespace pulsar
         void Reset()
         {
             Decref();
-            Handle = {};
-            ManagedPtr.reset();
+            RuntimeHandle = {};
         }
     };
 
@@ -452,7 +533,7 @@ namespace pulsar
         }
         RCPtr() : base() {}
         RCPtr(const ObjectHandle& handle) : base(handle) {}
-        RCPtr(const ObjectBase* ptr) : base(ptr ? ptr->GetObjectHandle() : ObjectHandle{}) {}
+        RCPtr(const ObjectBase* ptr) : base(ptr) {}
         RCPtr(const SPtr<T>& t) : base(t.get()) {}
 
         RCPtr(const RCPtrBase& ptr) : base(ptr) {}
@@ -575,13 +656,21 @@ namespace pulsar
 }
 namespace std
 {
+    template<>
+    struct hash<pulsar::RuntimeObjectHandle>
+    {
+        size_t operator()(const pulsar::RuntimeObjectHandle& handle) const noexcept
+        {
+            return std::hash<uint64_t>()(uint64_t(handle.Index) << 32 | handle.Generation);
+        }
+    };
 
     template<>
     struct hash<pulsar::ObjectPtrBase>
     {
         size_t operator()(const pulsar::ObjectPtrBase& ptr) const noexcept
         {
-            return std::hash<pulsar::ObjectHandle>()(ptr.GetHandle());
+            return std::hash<pulsar::RuntimeObjectHandle>()(ptr.RuntimeHandle);
         }
     };
 
@@ -590,7 +679,7 @@ namespace std
     {
         size_t operator()(const pulsar::ObjectPtr<T>& ptr) const noexcept
         {
-            return std::hash<pulsar::ObjectHandle>()(ptr.GetHandle());
+            return std::hash<pulsar::RuntimeObjectHandle>()(ptr.RuntimeHandle);
         }
     };
 
@@ -599,7 +688,7 @@ namespace std
     {
         size_t operator()(const pulsar::RCPtrBase& ptr) const noexcept
         {
-            return std::hash<pulsar::ObjectHandle>()(ptr.GetHandle());
+            return std::hash<pulsar::RuntimeObjectHandle>()(ptr.RuntimeHandle);
         }
     };
 
@@ -608,7 +697,7 @@ namespace std
     {
         size_t operator()(const pulsar::RCPtr<T>& ptr) const noexcept
         {
-            return std::hash<pulsar::ObjectHandle>()(ptr.GetHandle());
+            return std::hash<pulsar::RuntimeObjectHandle>()(ptr.RuntimeHandle);
         }
     };
 }
\ No newline at end of file
@@ -12,7 +12,6 @@ namespace pulsar
         array_list<StaticMeshVertex> m_verties;
 
         gfx::GFXBuffer_sp m_vertBuffer;
-        gfx::GFXBuffer_sp m_meshConstantBuffer;
         gfx::GFXDescriptorSet_sp m_meshObjDescriptorSet;
         gfx::GFXDescriptorSetLayout_sp m_meshDescriptorSetLayout;
 
@@ -29,7 +28,6 @@ namespace pulsar
         void OnCreateResource() override;
         void OnDestroyResource() override;
 
-        void OnChangedTransform() override;
         array_list<rendering::MeshBatch> GetMeshBatchs() override;
     };
 
@@ -0,0 +1,55 @@
+#pragma once
+#include "RenderObject.h"
+
+namespace pulsar::rendering
+{
+    // elements of an instancing batch that share vertex and index buffers
+    struct MeshBatchInstanceGroup
+    {
+        gfx::GFXBuffer_sp Vertex;
+        gfx::GFXBuffer_sp Indices;
+        array_list<RenderObject*> Instances;
+    };
+
+    struct CachedMeshBatch
+    {
+        size_t RenderState{};
+        MeshBatch Batch;
+
+        array_list<MeshBatchInstanceGroup> InstanceGroups;
+        // element indices of every owner, so removing an owner does not scan the batch
+        hash_map<RenderObject*, array_list<size_t>> OwnerElements;
+        bool IsDirtyElements{};
+    };
+
+    // world level batches, only rebuilt when a render object is added, removed or submits a change
+    class MeshBatchCache
+    {
+    public:
+        MeshBatchCache() = default;
+        MeshBatchCache(const MeshBatchCache&) = delete;
+        ~MeshBatchCache();
+
+        void Add(RenderObject* renderObject);
+        void Remove(RenderObject* renderObject);
+        void Update(RenderObject* renderObject);
+        void Clear();
+
+        // if dirty, sort elements by mesh and owner and rebuild instance groups of an instancing batch
+        void UpdateElements(CachedMeshBatch* cached);
+
+        bool Contains(RenderObject* renderObject) const { return m_objectStates.contains(renderObject); }
+
+        // sorted by pipeline (shader and state), then material
+        const array_list<CachedMeshBatch*>& GetBatches();
+        size_t GetBatchCount() const { return m_batches.size(); }
+
+    private:
+        void RemoveElements(RenderObject* renderObject);
+    private:
+        hash_map<size_t, std::unique_ptr<CachedMeshBatch>> m_batches;
+        hash_map<RenderObject*, array_list<size_t>> m_objectStates;
+        array_list<CachedMeshBatch*> m_sortedBatches;
+        bool m_isDirtySorting{};
+    };
+}
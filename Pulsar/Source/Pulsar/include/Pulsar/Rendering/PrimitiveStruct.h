@@ -22,7 +22,14 @@ namespace pulsar
         Matrix4f WorldToLocalMatrix;
         Matrix4f NormalLocalToWorldMatrix;
         Vector4f NodePosition;
+        uint32_t ShaderFlags;
+        uint32_t _Padding0;
+        Vector2f _Padding1;
+        Vector4f _Padding2;
+        Vector4f _Padding3;
     };
+    // must match PerObjectCBufferStruct, also used as structured buffer stride for instancing
+    static_assert(sizeof(CBuffer_ModelObject) == 256);
 
     constexpr uint32_t kRenderingDescriptorSpace_ModelInfo = 2;
 }
\ No newline at end of file
@@ -5,15 +5,21 @@
 #include <Pulsar/EngineMath.h>
 #include <gfx/GFXApplication.h>
 #include <gfx/GFXBuffer.h>
+#include <array>
 
 namespace pulsar::rendering
 {
 
+    class RenderObject;
+    class MeshBatchCache;
+
     struct MeshBatchElement
     {
         gfx::GFXBuffer_sp Vertex;
         gfx::GFXBuffer_sp Indices;
         gfx::GFXDescriptorSet_sp ModelDescriptor;
+        // filled by MeshBatchCache
+        RenderObject* Owner{};
     };
 
     struct MeshBatch
@@ -28,13 +34,17 @@ namespace pulsar::rendering
         bool IsCastShadow{};
         gfx::GFXCullMode CullMode{};
         bool IsReverseCulling{false};
+        // elements sharing the same vertex buffer are drawn with one instanced call
+        bool IsInstancing{false};
 
         size_t GetRenderState() const
         {
             constexpr size_t prime = 16777619;
-            return (2166136261 * prime
+            return ((((2166136261 * prime
                 ^ std::hash<RCPtrBase>()(Material)) * prime
-                ^ State.GetHashCode() * prime;
+                ^ State.GetHashCode() * prime) * prime
+                ^ static_cast<size_t>(IsReverseCulling)) * prime
+                ^ static_cast<size_t>(IsInstancing));
         }
 
         gfx::GFXCullMode GetCullMode() const
@@ -65,6 +75,7 @@ namespace pulsar::rendering
 
     class RenderObject
     {
+        friend class MeshBatchCache;
     public:
         virtual ~RenderObject() = default;
         void SetTransform(const Matrix4f& localToWorld);
@@ -81,6 +92,32 @@ namespace pulsar::rendering
         virtual bool IsActive() const { return m_active; };
 
         bool IsDetermiantNegative() const { return m_isLocalToWorldDeterminantNegative; }
+        const CBuffer_ModelObject& GetPerModelData() const { return m_perModelData; }
+
+        // objects without bounds are never culled
+        bool HasBounds() const { return m_hasBounds; }
+        const BoxSphereBounds3f& GetBoundsWS() const { return m_boundsWS; }
+        void SetBoundsWS(const BoxSphereBounds3f& bounds)
+        {
+            m_boundsWS = bounds;
+            m_hasBounds = true;
+        }
+        void ClearBounds() { m_hasBounds = false; }
+
+        // views culled at the same time must use distinct slots, see kMaxConcurrentViews
+        static constexpr uint32_t kMaxConcurrentViews = 8;
+        void MarkVisible(uint32_t viewId) { m_visibleViewIds[viewId % kMaxConcurrentViews] = viewId; }
+        bool IsVisibleInView(uint32_t viewId) const { return m_visibleViewIds[viewId % kMaxConcurrentViews] == viewId; }
+
+        // model data is written to the frame dynamic buffer at draw time,
+        // all render objects share one set and bind it with a dynamic offset
+        static gfx::GFXDescriptorSetLayout_sp GetModelDescriptorSetLayout();
+        static gfx::GFXDescriptorSet_sp GetModelDescriptorSet();
+        static size_t GetMaxModelCountPerDraw();
+
+    protected:
+        // the batches returned by GetMeshBatchs changed, refresh the world cache
+        void SubmitBatchsChanged();
 
     public:
 
@@ -89,6 +126,11 @@ namespace pulsar::rendering
         CBuffer_ModelObject  m_perModelData{};;
         bool      m_isLocalToWorldDeterminantNegative{};
         int       m_lineWidth{1};
+        BoxSphereBounds3f m_boundsWS{};
+        bool      m_hasBounds{};
+        std::array<uint32_t, kMaxConcurrentViews> m_visibleViewIds{};
+    private:
+        MeshBatchCache* m_batchCache{};
     };
     CORELIB_DECL_SHORTSPTR(RenderObject);
 }
\ No newline at end of file
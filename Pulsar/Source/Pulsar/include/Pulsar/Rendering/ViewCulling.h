@@ -0,0 +1,34 @@
+#pragma once
+#include "RenderObject.h"
+
+namespace pulsar::rendering
+{
+    struct ViewCullingStats
+    {
+        uint32_t VisibleCount{};
+        uint32_t FrustumCulledCount{};
+        uint32_t DistanceCulledCount{};
+
+        uint32_t GetCulledCount() const { return FrustumCulledCount + DistanceCulledCount; }
+    };
+
+    class ViewCulling
+    {
+    public:
+        // maxDrawDistance <= 0 means unlimited
+        ViewCulling(const Matrix4f& viewProjection, const Vector3f& viewPosition, float maxDrawDistance);
+
+        bool IsVisible(const RenderObject* renderObject, ViewCullingStats* stats = nullptr) const;
+
+        // marks visible objects with viewId, test them with RenderObject::IsVisibleInView
+        void Cull(
+            const hash_set<RenderObject_sp>& renderObjects,
+            uint32_t viewId,
+            ViewCullingStats* stats = nullptr) const;
+
+    private:
+        Frustum3f m_frustum;
+        Vector3f m_viewPosition;
+        float m_maxDrawDistance;
+    };
+}
@@ -97,7 +97,6 @@ namespace pulsar
     public:
         void BeginScene(World* world);
         void EndScene();
-        virtual void Tick(Ticker ticker);
         virtual void BeginPlay();
         virtual void EndPlay();
 
@@ -127,7 +126,6 @@ namespace pulsar
 
         World* m_runtimeWorld = nullptr;
 
-
         array_list<DirectionalLightSceneInfo*> m_directionalLights;
         array_list<SkyLightSceneInfo*> m_skyLights;
 
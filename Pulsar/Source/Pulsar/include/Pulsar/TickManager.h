@@ -0,0 +1,82 @@
+#pragma once
+#include "Ticker.h"
+#include <functional>
+
+namespace pulsar
+{
+    class Component;
+
+    // groups run one after another in this order, only while the world is playing
+    enum class TickGroup : uint8_t
+    {
+        PrePhysics,
+        Physics,
+        PostPhysics,
+        Late,
+    };
+    constexpr size_t kTickGroupCount = 4;
+
+    // data a tick reads or writes. ticks of one group run concurrently on the job system
+    // when none of them writes something another one reads or writes.
+    enum class TickAccess : uint32_t
+    {
+        None      = 0,
+        // reads count as writes, the getters of TransformManager update its arrays lazily
+        Transform = 1 << 0,
+        Physics   = 1 << 1,
+        Input     = 1 << 2,
+        Audio     = 1 << 3,
+        // creating, destroying, activating and deactivating nodes or components.
+        // ticks that write it always run alone on the main thread
+        Hierarchy = 1 << 4,
+        All       = 0xFFFFFFFF,
+    };
+    ENUM_CLASS_FLAGS(TickAccess);
+
+    class TickManager
+    {
+    public:
+        void AddComponent(Component* component);
+        void RemoveComponent(Component* component);
+
+        // world level work like the physics steps, runs before the components of its group
+        void AddSystemTick(TickGroup group, TickAccess reads, TickAccess writes, std::function<void(Ticker)> func);
+
+        void RunGroup(TickGroup group, Ticker ticker);
+
+        size_t GetComponentCount(TickGroup group) const { return m_components[static_cast<size_t>(group)].size(); }
+    protected:
+        struct ComponentEntry
+        {
+            Component* Owner;
+            TickAccess Reads;
+            TickAccess Writes;
+        };
+        struct SystemEntry
+        {
+            std::function<void(Ticker)> Func;
+            TickAccess Reads;
+            TickAccess Writes;
+        };
+        // one of both is set
+        struct PhaseTick
+        {
+            Component* Owner;
+            const SystemEntry* System;
+        };
+
+        void Schedule(PhaseTick tick, TickAccess reads, TickAccess writes, Ticker ticker);
+        void FlushPhase(Ticker ticker);
+        void RemoveTombstones();
+
+        array_list<ComponentEntry> m_components[kTickGroupCount];
+        array_list<SystemEntry>    m_systems[kTickGroupCount];
+        // ticks that can run concurrently, collected until the next conflicting tick
+        array_list<PhaseTick> m_phase;
+        TickAccess m_phaseReads = TickAccess::None;
+        TickAccess m_phaseWrites = TickAccess::None;
+
+        bool m_isRunning = false;
+        bool m_hasTombstones = false;
+    };
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "ObjectBase.h"
+
+namespace pulsar
+{
+    class TransformComponent;
+
+    // world transforms of the active transform components, kept in flat arrays sorted by hierarchy depth
+    // so parents always come before their children. world matrices are rebuilt in one forward pass over
+    // the dirty range, inverses are only computed when asked for.
+    class TransformManager
+    {
+    public:
+        static constexpr uint32_t kInvalidHandle = UINT32_MAX;
+
+        uint32_t Register(TransformComponent* owner);
+        void Unregister(uint32_t handle);
+
+        void SetLocalTransform(uint32_t handle, const Vector3f& position, const Quat4f& rotation, const Vector3f& scale);
+        // call when a registered transform changes its parent
+        void MarkHierarchyChanged() { m_isOrderDirty = true; }
+
+        // the references are valid until the next Register, Update or RebuildOrder. the getters themselves
+        // rebuild the order after an Unregister or a hierarchy change, so copy the matrix before the next one
+        const Matrix4f& GetLocalToWorldMatrix(uint32_t handle);
+        const Matrix4f& GetWorldToLocalMatrix(uint32_t handle);
+
+        // rebuilds the remaining dirty range and notifies the nodes whose world transform changed
+        void Update();
+
+        size_t GetTransformCount() const { return m_owners.size(); }
+    protected:
+        enum Flags : uint8_t
+        {
+            Flags_Dirty = 1 << 0,
+            Flags_Changed = 1 << 1,
+            Flags_InverseValid = 1 << 2,
+        };
+        static constexpr uint32_t kNoParent = UINT32_MAX;
+
+        uint32_t FindParentIndex(const TransformComponent* owner) const;
+        void RebuildOrder();
+        void UpdateRange(size_t begin, size_t end);
+        void MarkDirty(uint32_t index);
+
+        // per transform, indexed in depth order
+        array_list<Vector3f>            m_positions;
+        array_list<Quat4f>              m_rotations;
+        array_list<Vector3f>            m_scales;
+        array_list<uint32_t>            m_parents;
+        array_list<Matrix4f>            m_localToWorld;
+        array_list<Matrix4f>            m_worldToLocal;
+        array_list<uint8_t>             m_flags;
+        // null for removed transforms until the next reorder
+        array_list<TransformComponent*> m_owners;
+        array_list<uint32_t>            m_indexToHandle;
+
+        array_list<uint32_t> m_handleToIndex;
+        array_list<uint32_t> m_freeHandles;
+
+        // everything before this index is up to date
+        size_t m_firstDirty = 0;
+        bool   m_isOrderDirty = false;
+    };
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+namespace pulsar
+{
+    // read only memory mapping of a whole file, pages are loaded by the os on access
+    class MappedFile
+    {
+    public:
+        static std::shared_ptr<MappedFile> Open(const std::filesystem::path& path);
+
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+
+        const uint8_t* GetData() const { return m_data; }
+        size_t GetSize() const { return m_size; }
+    protected:
+        const uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+#ifdef _WIN32
+        void* m_file = nullptr;
+        void* m_mapping = nullptr;
+#endif
+    };
+
+    // read only view into mapped memory, keeps the owner alive
+    struct BulkDataView
+    {
+        std::shared_ptr<const void> Owner;
+        const uint8_t* Data = nullptr;
+        size_t Size = 0;
+
+        bool IsValid() const { return Data != nullptr; }
+        BulkDataView SubView(size_t offset, size_t size) const { return {Owner, Data + offset, size}; }
+    };
+}
@@ -1,12 +1,16 @@
 #pragma once
 #include "Assets/Material.h"
 #include "CameraManager.h"
+#include "ComponentManager.h"
 #include "Components/Component.h"
 #include "ObjectBase.h"
+#include "Rendering/MeshBatchCache.h"
 #include "Rendering/RenderObject.h"
 #include "SceneCaptureManager.h"
 #include "SelectionSet.h"
 #include "Simulate.h"
+#include "TickManager.h"
+#include "TransformManager.h"
 
 namespace pulsar
 {
@@ -97,15 +101,19 @@ namespace pulsar
 
 
     public: //rendering
-        array_list<ObjectPtrBase>&      GetDeferredDestroyedQueue() { return m_deferredDestroyedQueue; }
+        DeferredDestroyQueue&           GetDeferredDestroyedQueue() { return m_deferredDestroyedQueue; }
         gfx::GFXDescriptorSet_sp        GetWorldDescriptorSet() const { return m_worldDescriptors; }
         const hash_set<rendering::RenderObject_sp>& GetRenderObjects() const { return m_renderObjects; }
         void            AddRenderObject(const rendering::RenderObject_sp& renderObject);
         void            RemoveRenderObject(rendering::RenderObject_rsp renderObject);
+        rendering::MeshBatchCache& GetMeshBatchCache() { return m_meshBatchCache; }
         CameraManager&        GetCameraManager() { return m_cameraManager; }
         SceneCaptureManager&  GetCaptureManager() { return m_captureManager; }
         GizmosManager&        GetGizmosManager() { return m_gizmosManager; }
         SimulateManager&      GetSimulateManager() { return m_simulateManager; }
+        TransformManager&     GetTransformManager() { return m_transformManager; }
+        ComponentManager&     GetComponentManager() { return m_componentManager; }
+        TickManager&          GetTickManager() { return m_tickManager; }
         PhysicsWorld2D*       GetPhysicsWorld2D() const { return m_physicsWorld2D; }
         PhysicsWorld3D*       GetPhysicsWorld3D() const { return m_physicsWorld3D; }
         LightManager*         GetLightManager() const { return m_lightManager; }
@@ -118,13 +126,18 @@ namespace pulsar
         PhysicsWorld3D* m_physicsWorld3D = nullptr;
         LightManager*   m_lightManager = nullptr;
 
+        // declared before the scenes, their components unregister from it when released
+        TransformManager                      m_transformManager;
+        ComponentManager                      m_componentManager;
+        TickManager                           m_tickManager;
         RCPtr<Material>                       m_defaultMaterial;
         hash_set<rendering::RenderObject_sp>  m_renderObjects;
+        rendering::MeshBatchCache             m_meshBatchCache;
         array_list<RCPtr<Scene>>              m_scenes;
         RCPtr<Scene>                          m_focusScene;
         CameraManager                         m_cameraManager;
         SceneCaptureManager                   m_captureManager;
-        array_list<ObjectPtrBase>             m_deferredDestroyedQueue;
+        DeferredDestroyQueue                  m_deferredDestroyedQueue;
         SimulateManager                       m_simulateManager;
 
         gfx::GFXDescriptorSetLayout_sp m_worldDescriptorLayout;
@@ -1,11 +1,83 @@
 #include "Application.h"
 #include "EngineAppInstance.h"
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <thread>
 
+// a slow frame must not stall the collector, every pass gets its own budget
+static bool CheckGCollectBacklog()
+{
+    using namespace pulsar;
+    constexpr size_t kObjectCount = 20000;
+    constexpr size_t kMinProcessed = 16;
+
+    RuntimeObjectManager::SetGCollectBudget(1000);
+    for (size_t i = 0; i < kObjectCount; ++i)
+    {
+        auto obj = mksptr(new ObjectBase);
+        obj->Construct();
+        RuntimeObjectManager::DeferDestroyObject(obj->GetRuntimeHandle());
+    }
 
+    bool passed = true;
+    size_t backlog = kObjectCount;
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        // longer than the budget, as rendering and the editor ui are before TickGCollect
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        RuntimeObjectManager::TickGCollect();
 
-int main()
+        const auto stats = RuntimeObjectManager::GetGCollectStats();
+        if (stats.Processed <= kMinProcessed || stats.Backlog + kMinProcessed >= backlog)
+        {
+            std::printf("gcollect check failed, frame %d processed %zu, backlog %zu -> %zu\n",
+                frame, stats.Processed, backlog, stats.Backlog);
+            passed = false;
+        }
+        backlog = stats.Backlog;
+    }
+
+    RuntimeObjectManager::DrainGCollect();
+    if (RuntimeObjectManager::GetGCollectStats().Backlog != 0)
+    {
+        std::printf("gcollect check failed, backlog left after a drain\n");
+        passed = false;
+    }
+    return passed;
+}
+
+int main(int argc, char** argv)
 {
     using namespace pulsar;
-    Application::Exec(new EngineAppInstance(), "Pulsar", { 1280,720 });
-    return 0;
-}
\ No newline at end of file
+    for (int i = 1; i < argc; ++i)
+    {
+        // -check-gcollect, runs the collector on a large backlog without starting the app
+        if (std::string_view{argv[i]} == "-check-gcollect")
+        {
+            return CheckGCollectBacklog() ? 0 : 1;
+        }
+    }
+
+    auto instance = new EngineAppInstance();
+    for (int i = 1; i < argc; ++i)
+    {
+        // -headless [frames], runs on the null gfx backend
+        if (std::string_view{argv[i]} == "-headless")
+        {
+            uint32_t frameCount = 0;
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                frameCount = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            instance->SetHeadless(frameCount);
+        }
+        // -check-stats, fails a headless run whose render cost grows, see SetCheckHeadlessStats
+        else if (std::string_view{argv[i]} == "-check-stats")
+        {
+            instance->SetCheckHeadlessStats(true);
+        }
+    }
+    Application::Exec(instance, "Pulsar", { 1280,720 });
+    return instance->IsHeadlessStatsPassed() ? 0 : 1;
+}
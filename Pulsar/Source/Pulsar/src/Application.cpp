@@ -1,6 +1,10 @@
 ﻿#include <Pulsar/Application.h>
 #include <gfx-vk/GFXVulkanApplication.h>
+#include <gfx-null/GFXNullApplication.h>
 #include "AppInstance.h"
+#include "JobSystem.h"
+#include "Logger.h"
+#include <format>
 
 
 namespace pulsar
@@ -11,11 +15,16 @@ namespace pulsar
     {
         return g_currentInst;
     }
-    static gfx::GFXVulkanApplication* g_gfxApp = nullptr;
+    static gfx::GFXApplication* g_gfxApp = nullptr;
     gfx::GFXApplication* Application::GetGfxApp()
     {
         return g_gfxApp;
     }
+    static JobSystem* g_jobSystem = nullptr;
+    JobSystem* Application::GetJobSystem()
+    {
+        return g_jobSystem;
+    }
     int Application::Exec(AppInstance* instance, string_view title, Vector2f size)
     {
         Watch.Start();
@@ -32,7 +41,16 @@ namespace pulsar
 
         Watch.Record("preinitiialize");
 
-        g_gfxApp = new gfx::GFXVulkanApplication(gfxConfig);
+        g_jobSystem = new JobSystem();
+
+        if (gfxConfig.Api == gfx::GFXApi::Null)
+        {
+            g_gfxApp = new gfx::GFXNullApplication(gfxConfig);
+        }
+        else
+        {
+            g_gfxApp = new gfx::GFXVulkanApplication(gfxConfig);
+        }
         g_gfxApp->Initialize();
 
         Watch.Record("gfx initialize");
@@ -51,9 +69,32 @@ namespace pulsar
             g_currentInst->OnEndRender(dt);
         };
         g_gfxApp->ExecLoop();
+
+        if (auto nullApp = dynamic_cast<gfx::GFXNullApplication*>(g_gfxApp))
+        {
+            const auto stats = nullApp->GetStatistics();
+            Logger::Log(std::format(
+                "headless frames: {}, command buffers: {}, commands: {}, draws: {}, "
+                "pipeline binds: {} ({} skipped), descriptor set binds: {} ({} skipped), "
+                "vertex buffer binds: {} ({} skipped), index buffer binds: {} ({} skipped), "
+                "uploads: {} ({} bytes), dynamic allocations: {} ({} bytes), "
+                "buffers: {}, textures: {}, descriptor sets: {}, pipelines: {}",
+                stats.FrameCount, stats.SubmittedCommandBufferCount, stats.CommandCount, stats.DrawCount,
+                stats.PipelineBindCount, stats.SkippedPipelineBindCount,
+                stats.DescriptorSetBindCount, stats.SkippedDescriptorSetBindCount,
+                stats.VertexBufferBindCount, stats.SkippedVertexBufferBindCount,
+                stats.IndexBufferBindCount, stats.SkippedIndexBufferBindCount,
+                stats.BufferUploadCount, stats.BufferUploadSize,
+                stats.DynamicBufferAllocationCount, stats.DynamicBufferAllocationSize,
+                stats.BufferAllocationCount, stats.TextureAllocationCount,
+                stats.DescriptorSetAllocationCount, stats.PipelineCreateCount));
+        }
+
         instance->OnTerminate();
         g_gfxApp->Terminate();
         delete g_gfxApp;
+        delete g_jobSystem;
+        g_jobSystem = nullptr;
 
         return 0;
     }
@@ -9,4 +9,58 @@ namespace pulsar
     {
         return Application::inst()->GetAssetManager();
     }
-}
\ No newline at end of file
+
+    AssetLoadHandle AssetManager::LoadAssetAsync(string_view path, AssetLoadPriority priority)
+    {
+        auto request = std::make_shared<AssetLoadRequest>();
+        request->Path = path;
+        request->Priority = priority;
+        request->Asset = LoadAssetAtPath(path);
+        request->Status.store(AssetLoadStatus::Uploading, std::memory_order_release);
+
+        std::lock_guard lock{m_loadedRequestsMutex};
+        m_loadedRequests.push_back(request);
+        return request;
+    }
+
+    AssetLoadHandle AssetManager::LoadAssetAsync(ObjectHandle id, AssetLoadPriority priority)
+    {
+        auto request = std::make_shared<AssetLoadRequest>();
+        request->Handle = id;
+        request->Priority = priority;
+        request->Asset = LoadAssetById(id);
+        request->Status.store(AssetLoadStatus::Uploading, std::memory_order_release);
+
+        std::lock_guard lock{m_loadedRequestsMutex};
+        m_loadedRequests.push_back(request);
+        return request;
+    }
+
+    void AssetManager::Tick()
+    {
+        array_list<AssetLoadHandle> requests;
+        {
+            std::lock_guard lock{m_loadedRequestsMutex};
+            requests.swap(m_loadedRequests);
+        }
+
+        for (auto& request : requests)
+        {
+            AssetLoadStatus status;
+            if (request->IsCancelled.load(std::memory_order_acquire))
+            {
+                request->Asset = nullptr;
+                status = AssetLoadStatus::Cancelled;
+            }
+            else
+            {
+                status = request->Asset ? AssetLoadStatus::Completed : AssetLoadStatus::Failed;
+            }
+            request->Status.store(status, std::memory_order_release);
+            if (request->OnDone)
+            {
+                request->OnDone(*request);
+            }
+        }
+    }
+}
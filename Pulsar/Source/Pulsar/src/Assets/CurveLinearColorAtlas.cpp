@@ -20,7 +20,7 @@ namespace pulsar
             auto list = s->Object->New(ser::VarientType::Array);
             for (auto& element : *m_colorCurveAssets)
             {
-                list->Push(element.Handle.to_string());
+                list->Push(element.GetHandle().to_string());
             }
             s->Object->Add("curves", list);
         }
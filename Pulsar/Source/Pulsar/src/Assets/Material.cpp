@@ -48,7 +48,7 @@ namespace pulsar
 
         m_createdGpuResource = true;
 
-        const auto& passes = shader->GetSourceData().ApiMaps.at(Application::GetGfxApp()->GetApiType());
+        const auto& passes = shader->GetSourceData().ApiMaps.at(Application::GetGfxApp()->GetShaderApiType());
         auto shaderConfig = shader->GetConfig();
 
         // process deferred
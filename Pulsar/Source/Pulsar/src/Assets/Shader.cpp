@@ -88,7 +88,7 @@ namespace pulsar
     void Shader::ResetShaderSource(ShaderSourceData&& serData)
     {
         m_shaderSource = std::move(serData);
-        auto& cfg = m_shaderSource.ApiMaps.at(Application::GetGfxApp()->GetApiType()).Config;
+        auto& cfg = m_shaderSource.ApiMaps.at(Application::GetGfxApp()->GetShaderApiType()).Config;
         m_shaderConfig = ser::JsonSerializer::Deserialize<ShaderPassConfig>(cfg);
 
         Initialize();
@@ -202,7 +202,7 @@ namespace pulsar
     }
     void Shader::Initialize()
     {
-        const auto currentApi = Application::GetGfxApp()->GetApiType();
+        const auto currentApi = Application::GetGfxApp()->GetShaderApiType();
         if (!m_shaderSource.ApiMaps.contains(currentApi))
         {
             SetReady(false);
@@ -34,6 +34,7 @@ namespace pulsar
         base::OnInstantiateAsset(obj);
         auto mesh = static_cast<ThisClass*>(obj);
         mesh->m_sections = m_sections;
+        mesh->m_mappedSections = m_mappedSections;
     }
 
     bool StaticMesh::CreateGPUResource()
@@ -43,19 +44,28 @@ namespace pulsar
             return true;
         }
         m_isCreatedResource = true;
-        for (auto& section : m_sections)
-        {
-            auto vertSize = section.Vertex.size() * kSizeofStaticMeshVertex;
+
+        auto createBuffers = [this](const void* vertex, size_t vertexCount, const void* indices, size_t indexCount) {
+            auto vertSize = vertexCount * kSizeofStaticMeshVertex;
             auto vertBuffer = Application::GetGfxApp()->CreateBuffer(gfx::GFXBufferUsage::Vertex, vertSize);
-            vertBuffer->Fill(section.Vertex.data());
-            vertBuffer->SetElementCount(section.Vertex.size());
+            vertBuffer->Fill(vertex);
+            vertBuffer->SetElementCount(vertexCount);
             m_vertexBuffers.push_back(vertBuffer);
 
-            auto indicesSize = section.Indices.size() * sizeof(decltype(section.Indices)::value_type);
+            auto indicesSize = indexCount * sizeof(uint32_t);
             auto indicesBuffer = Application::GetGfxApp()->CreateBuffer(gfx::GFXBufferUsage::Index, indicesSize);
-            indicesBuffer->Fill(section.Indices.data());
-            indicesBuffer->SetElementCount(section.Indices.size());
+            indicesBuffer->Fill(indices);
+            indicesBuffer->SetElementCount(indexCount);
             m_indicesBuffers.push_back(indicesBuffer);
+        };
+
+        for (auto& section : m_sections)
+        {
+            createBuffers(section.Vertex.data(), section.Vertex.size(), section.Indices.data(), section.Indices.size());
+        }
+        for (auto& section : m_mappedSections)
+        {
+            createBuffers(section.Vertex.Data, section.VertexCount, section.Indices.Data, section.IndexCount);
         }
         return true;
     }
@@ -93,10 +103,44 @@ namespace pulsar
         if (!s->IsWrite)
         {
             m_sections.clear();
+            m_mappedSections.clear();
             m_materialNames.clear();
         }
 
-        sser::ReadWriteStream(s->Stream, s->IsWrite, m_sections);
+        if (s->CookedOnly)
+        {
+            SerializeCookedSections(s);
+        }
+        else
+        {
+            int32_t version = 1;
+            if (s->IsWrite)
+            {
+                version = SerializeVersion;
+                s->Object->Add("SerializeVersion", version);
+            }
+            else if (auto versionObject = s->Object->At("SerializeVersion"))
+            {
+                version = versionObject->AsInt();
+            }
+
+            if (version >= 2)
+            {
+                uint32_t count = static_cast<uint32_t>(m_sections.size());
+                sser::ReadWriteLittleEndian(s->Stream, s->IsWrite, count);
+                m_sections.resize(count);
+                for (auto& section : m_sections)
+                {
+                    sser::ReadWriteBulk(s->Stream, s->IsWrite, section.Vertex);
+                    sser::ReadWriteBulk(s->Stream, s->IsWrite, section.Indices);
+                    sser::ReadWriteLittleEndian(s->Stream, s->IsWrite, section.MaterialIndex);
+                }
+            }
+            else
+            {
+                sser::ReadWriteStream(s->Stream, s->IsWrite, m_sections);
+            }
+        }
         if (s->IsWrite)
         {
             auto materialNames = s->Object->New(ser::VarientType::Array);
@@ -125,6 +169,138 @@ namespace pulsar
         }
     }
 
+    namespace
+    {
+        // cooked bulk layout: section count, then per section this header, the vertices and the indices.
+        // the count and the header are little endian, the arrays keep the host layout like other bulk structs
+        struct CookedSectionHeader
+        {
+            uint32_t VertexCount;
+            uint32_t IndexCount;
+            int32_t MaterialIndex;
+            uint32_t Reserved;
+        };
+        constexpr size_t kCookedSectionHeaderSize = 16;
+        static_assert(std::is_trivially_copyable_v<StaticMeshVertex>);
+
+        std::iostream& ReadWriteStream(std::iostream& stream, bool isWrite, CookedSectionHeader& header)
+        {
+            sser::ReadWriteLittleEndian(stream, isWrite, header.VertexCount);
+            sser::ReadWriteLittleEndian(stream, isWrite, header.IndexCount);
+            sser::ReadWriteLittleEndian(stream, isWrite, header.MaterialIndex);
+            sser::ReadWriteLittleEndian(stream, isWrite, header.Reserved);
+            return stream;
+        }
+
+        // bytes left in the stream, max when it can not seek
+        size_t GetRemainingSize(std::iostream& stream)
+        {
+            const auto pos = stream.tellg();
+            if (pos == std::streampos(-1) || !stream.seekg(0, std::ios::end))
+            {
+                stream.clear();
+                return SIZE_MAX;
+            }
+            const auto end = stream.tellg();
+            stream.seekg(pos);
+            return end > pos ? static_cast<size_t>(end - pos) : 0;
+        }
+    }
+
+    void StaticMesh::SerializeCookedSections(AssetSerializer* s)
+    {
+        auto& stream = s->Stream;
+        if (s->IsWrite)
+        {
+            uint64_t count = m_sections.size();
+            sser::ReadWriteLittleEndian(stream, true, count);
+            for (auto& section : m_sections)
+            {
+                CookedSectionHeader header{
+                    static_cast<uint32_t>(section.Vertex.size()),
+                    static_cast<uint32_t>(section.Indices.size()),
+                    section.MaterialIndex, 0};
+                ReadWriteStream(stream, true, header);
+                stream.write(reinterpret_cast<const char*>(section.Vertex.data()), static_cast<std::streamsize>(section.GetVertexAllocSize()));
+                stream.write(reinterpret_cast<const char*>(section.Indices.data()), static_cast<std::streamsize>(section.GetIndicesAllocSize()));
+            }
+            return;
+        }
+
+        // the stream reads the counts and headers. mapped data is the same bytes, its arrays are kept as views
+        const auto& bulk = s->MappedBulkData;
+        const bool isMapped = bulk.IsValid();
+        size_t remaining = GetRemainingSize(stream);
+        if (isMapped)
+        {
+            remaining = std::min(remaining, bulk.Size);
+        }
+        // sizes are checked before anything is allocated or read from a damaged package
+        auto consume = [&](size_t size) {
+            if (size > remaining)
+            {
+                throw EngineException("cooked static mesh data is truncated");
+            }
+            const auto offset = bulk.Size - remaining;
+            remaining -= size;
+            return offset;
+        };
+        auto check = [&] {
+            if (!stream)
+            {
+                throw EngineException("cooked static mesh data is truncated");
+            }
+        };
+
+        uint64_t count{};
+        consume(sizeof(count));
+        sser::ReadWriteLittleEndian(stream, false, count);
+        check();
+        if (count > remaining / kCookedSectionHeaderSize)
+        {
+            throw EngineException("cooked static mesh data is truncated");
+        }
+
+        if (isMapped)
+        {
+            m_mappedSections.reserve(count);
+        }
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            CookedSectionHeader header{};
+            consume(kCookedSectionHeaderSize);
+            ReadWriteStream(stream, false, header);
+            check();
+
+            const auto vertexSize = size_t{header.VertexCount} * sizeof(StaticMeshVertex);
+            const auto indexSize = size_t{header.IndexCount} * sizeof(uint32_t);
+            const auto vertexOffset = consume(vertexSize);
+            const auto indexOffset = consume(indexSize);
+
+            if (isMapped)
+            {
+                auto& section = m_mappedSections.emplace_back();
+                section.VertexCount = header.VertexCount;
+                section.IndexCount = header.IndexCount;
+                section.MaterialIndex = header.MaterialIndex;
+                section.Vertex = bulk.SubView(vertexOffset, vertexSize);
+                section.Indices = bulk.SubView(indexOffset, indexSize);
+                stream.seekg(static_cast<std::streamoff>(vertexSize + indexSize), std::ios::cur);
+                check();
+                continue;
+            }
+
+            // not mapped, one read per array
+            auto& section = m_sections.emplace_back();
+            section.Vertex.resize(header.VertexCount);
+            section.Indices.resize(header.IndexCount);
+            section.MaterialIndex = header.MaterialIndex;
+            stream.read(reinterpret_cast<char*>(section.Vertex.data()), static_cast<std::streamsize>(vertexSize));
+            stream.read(reinterpret_cast<char*>(section.Indices.data()), static_cast<std::streamsize>(indexSize));
+            check();
+        }
+    }
+
     RCPtr<StaticMesh> StaticMesh::StaticCreate(
         string_view name,
         array_list<StaticMeshSection>&& vertData,
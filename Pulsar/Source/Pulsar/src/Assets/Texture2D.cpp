@@ -22,6 +22,11 @@ namespace pulsar
     void Texture2D::Serialize(AssetSerializer* s)
     {
         base::Serialize(s);
+        if (s->CookedOnly)
+        {
+            SerializeCooked(s);
+            return;
+        }
         if (s->IsWrite)
         {
             assert(m_loadedOriginMemory);
@@ -59,6 +64,66 @@ namespace pulsar
         }
     }
 
+    void Texture2D::SerializeCooked(AssetSerializer* s)
+    {
+        if (s->IsWrite)
+        {
+#ifdef WITH_EDITOR
+            auto nativeData = CompressNativeData();
+            s->Stream.write(reinterpret_cast<const char*>(nativeData.data()), static_cast<std::streamsize>(nativeData.size()));
+            s->Object->Add("NativeSize", static_cast<int>(nativeData.size()));
+#endif
+        }
+        else
+        {
+            // a short package must not upload uninitialized bytes
+            const auto nativeSizeValue = s->Object->At("NativeSize")->AsInt();
+            if (nativeSizeValue < 0)
+            {
+                throw EngineException("cooked texture data is truncated");
+            }
+            const auto nativeSize = static_cast<size_t>(nativeSizeValue);
+            if (s->MappedBulkData.IsValid())
+            {
+                if (s->MappedBulkData.Size < nativeSize)
+                {
+                    throw EngineException("cooked texture data is truncated");
+                }
+                m_nativeData = s->MappedBulkData.SubView(0, nativeSize);
+            }
+            else
+            {
+                m_nativeMemory.resize(nativeSize);
+                s->Stream.read(reinterpret_cast<char*>(m_nativeMemory.data()), static_cast<std::streamsize>(nativeSize));
+                if (static_cast<size_t>(s->Stream.gcount()) != nativeSize)
+                {
+                    m_nativeMemory.clear();
+                    throw EngineException("cooked texture data is truncated");
+                }
+                m_nativeData = {nullptr, m_nativeMemory.data(), m_nativeMemory.size()};
+            }
+        }
+
+        auto size = s->IsWrite ? s->Object->New(ser::VarientType::Object) : s->Object->At("Size");
+        if (s->IsWrite)
+        {
+            size->Add("x", m_textureSize.x);
+            size->Add("y", m_textureSize.y);
+            s->Object->Add("Size", size);
+            s->Object->Add("ChannelCount", m_channelCount);
+            s->Object->Add("IsSRGB", m_isSRGB);
+            s->Object->Add("CompressedFormat", mkbox(m_compressionFormat)->GetName());
+        }
+        else
+        {
+            m_textureSize.x = size->At("x")->AsInt();
+            m_textureSize.y = size->At("y")->AsInt();
+            m_channelCount = s->Object->At("ChannelCount")->AsInt();
+            m_isSRGB = s->Object->At("IsSRGB")->AsBool();
+            AssignEnum(m_compressionFormat, s->Object->At("CompressedFormat")->AsString());
+        }
+    }
+
     void Texture2D::OnDestroy()
     {
         base::OnDestroy();
@@ -111,34 +176,24 @@ namespace pulsar
 
         auto targetGfxFormat = _GetTextureFormat(m_compressionFormat);
 
-        array_list<uint8_t> data{};
+        // cooked textures upload straight from the package mapping
+        const uint8_t* nativeData = m_nativeData.Data;
+        size_t nativeSize = m_nativeData.Size;
 #ifdef WITH_EDITOR
+        array_list<uint8_t> data{};
+        if (!m_nativeData.IsValid())
         {
-            array_list<uint8_t> uncompressedData;
-            if (m_compressedOriginImage)
-            {
-                uncompressedData = gfx::LoadImageFromMemory(m_originMemory.data(), m_originMemory.size(),
-                                                               nullptr, nullptr, nullptr, m_channelCount, m_isSRGB);
-            }
-            else
-            {
-                uncompressedData = m_originMemory;
-            }
-            m_cachedUncompressedRawSize = uncompressedData.size();
-
-            auto compressedData = TextureCompressionUtil::Compress(
-                std::move(uncompressedData),
-                m_textureSize.x,
-                m_textureSize.y,
-                m_channelCount,
-                targetGfxFormat);
-            data = std::move(compressedData);
+            data = CompressNativeData();
+            nativeData = data.data();
+            nativeSize = data.size();
         }
-#else
-        data = m_nativeMemory;
 #endif
+        if (!nativeData)
+        {
+            return false;
+        }
 
-        m_cachedNativeSize = data.size();
+        m_cachedNativeSize = nativeSize;
 
         m_isCreatedGPUResource = true;
 
@@ -147,8 +202,8 @@ namespace pulsar
         samplerConfig.AddressMode = GetSamplerAddressMode();
 
         m_tex = Application::GetGfxApp()->CreateTexture2DFromMemory(
-            data.data(),
-            data.size(),
+            nativeData,
+            nativeSize,
             m_textureSize.x, m_textureSize.y,
             targetGfxFormat,
             samplerConfig);
@@ -156,6 +211,30 @@ namespace pulsar
         return true;
     }
 
+#ifdef WITH_EDITOR
+    array_list<uint8_t> Texture2D::CompressNativeData()
+    {
+        array_list<uint8_t> uncompressedData;
+        if (m_compressedOriginImage)
+        {
+            uncompressedData = gfx::LoadImageFromMemory(m_originMemory.data(), m_originMemory.size(),
+                                                           nullptr, nullptr, nullptr, m_channelCount, m_isSRGB);
+        }
+        else
+        {
+            uncompressedData = m_originMemory;
+        }
+        m_cachedUncompressedRawSize = uncompressedData.size();
+
+        return TextureCompressionUtil::Compress(
+            std::move(uncompressedData),
+            m_textureSize.x,
+            m_textureSize.y,
+            m_channelCount,
+            _GetTextureFormat(m_compressionFormat));
+    }
+#endif
+
     void Texture2D::DestroyGPUResource()
     {
         if (!IsCreatedGPUResource())
@@ -0,0 +1,68 @@
+#include <Pulsar/ComponentManager.h>
+#include "Components/Component.h"
+
+namespace pulsar
+{
+    void ComponentManager::Add(Component* component)
+    {
+        const auto id = component->GetComponentTypeInfo()->Id;
+        if (id >= m_components.size())
+        {
+            m_components.resize(id + 1);
+        }
+        auto& components = m_components[id];
+        component->m_componentManagerIndex = static_cast<uint32_t>(components.size());
+        components.push_back(component);
+    }
+
+    void ComponentManager::Remove(Component* component)
+    {
+        auto& components = m_components[component->GetComponentTypeInfo()->Id];
+        const auto index = component->m_componentManagerIndex;
+        components[index] = components.back();
+        components[index]->m_componentManagerIndex = index;
+        components.pop_back();
+        component->m_componentManagerIndex = Component::kInvalidManagerIndex;
+    }
+
+    void ComponentManager::ForEach(Type* type, const std::function<void(Component*)>& func) const
+    {
+        const auto info = ComponentTypeRegistry::GetInfo(type);
+        if (!info)
+        {
+            return;
+        }
+        array_list<uint32_t> ids;
+        ComponentTypeRegistry::GetDerivedIds(info, ids);
+        for (const auto id : ids)
+        {
+            if (id < m_components.size())
+            {
+                for (const auto component : m_components[id])
+                {
+                    func(component);
+                }
+            }
+        }
+    }
+
+    size_t ComponentManager::GetCount(Type* type) const
+    {
+        const auto info = ComponentTypeRegistry::GetInfo(type);
+        if (!info)
+        {
+            return 0;
+        }
+        array_list<uint32_t> ids;
+        ComponentTypeRegistry::GetDerivedIds(info, ids);
+        size_t count = 0;
+        for (const auto id : ids)
+        {
+            if (id < m_components.size())
+            {
+                count += m_components[id].size();
+            }
+        }
+        return count;
+    }
+}
@@ -92,6 +92,12 @@ namespace pulsar
         m_beginning = true;
         m_runtimeScene = GetNode()->GetRuntimeOwnerScene().GetPtr();
 
+        if (!m_componentTypeInfo)
+        {
+            m_componentTypeInfo = ComponentTypeRegistry::GetInfo(GetType());
+        }
+        GetWorld()->GetComponentManager().Add(this);
+
         if (m_canDrawGizmo)
         {
             GetWorld()->GetGizmosManager().AddGizmoComponent(this);
@@ -101,6 +107,11 @@ namespace pulsar
     {
         m_beginning = false;
 
+        if (m_componentManagerIndex != kInvalidManagerIndex)
+        {
+            GetWorld()->GetComponentManager().Remove(this);
+        }
+
         if (m_canDrawGizmo)
         {
             GetWorld()->GetGizmosManager().RemoveGizmoComponent(this);
@@ -0,0 +1,97 @@
+#include "Components/ComponentTypeRegistry.h"
+#include "Components/Component.h"
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+namespace pulsar
+{
+    namespace
+    {
+        struct Registry
+        {
+            std::shared_mutex Mutex;
+            // by Type::GetTypeIndex, null for unregistered and non component types
+            array_list<const ComponentTypeInfo*> TypeInfos;
+            array_list<bool> IsResolved;
+            array_list<std::unique_ptr<ComponentTypeInfo>> Infos;
+            array_list<array_list<uint32_t>> Derived;
+        };
+
+        Registry& GetRegistry()
+        {
+            static Registry registry;
+            return registry;
+        }
+
+        const ComponentTypeInfo* Register(Registry& registry, Type* type)
+        {
+            const auto index = type->GetTypeIndex();
+            if (index >= registry.TypeInfos.size())
+            {
+                registry.TypeInfos.resize(index + 1);
+                registry.IsResolved.resize(index + 1);
+            }
+            if (registry.IsResolved[index])
+            {
+                return registry.TypeInfos[index];
+            }
+            registry.IsResolved[index] = true;
+
+            const auto componentType = cltypeof<Component>();
+            if (!type->IsSubclassOf(componentType))
+            {
+                return nullptr;
+            }
+
+            if (type != componentType)
+            {
+                Register(registry, type->GetBase());
+            }
+            auto info = std::make_unique<ComponentTypeInfo>();
+            info->ComponentType = type;
+            info->Id = static_cast<uint32_t>(registry.Infos.size());
+
+            registry.Derived.emplace_back();
+            registry.Derived[info->Id].push_back(info->Id);
+            for (auto base = type; base != componentType;)
+            {
+                base = base->GetBase();
+                registry.Derived[registry.TypeInfos[base->GetTypeIndex()]->Id].push_back(info->Id);
+            }
+            registry.TypeInfos[index] = info.get();
+            registry.Infos.push_back(std::move(info));
+            return registry.TypeInfos[index];
+        }
+    }
+
+    const ComponentTypeInfo* ComponentTypeRegistry::GetInfo(Type* type)
+    {
+        auto& registry = GetRegistry();
+        const auto index = type->GetTypeIndex();
+        {
+            std::shared_lock lock{registry.Mutex};
+            if (index < registry.IsResolved.size() && registry.IsResolved[index])
+            {
+                return registry.TypeInfos[index];
+            }
+        }
+        std::unique_lock lock{registry.Mutex};
+        return Register(registry, type);
+    }
+
+    void ComponentTypeRegistry::GetDerivedIds(const ComponentTypeInfo* info, array_list<uint32_t>& out)
+    {
+        auto& registry = GetRegistry();
+        std::shared_lock lock{registry.Mutex};
+        const auto& derived = registry.Derived[info->Id];
+        out.insert(out.end(), derived.begin(), derived.end());
+    }
+
+    uint32_t ComponentTypeRegistry::GetCount()
+    {
+        auto& registry = GetRegistry();
+        std::shared_lock lock{registry.Mutex};
+        return static_cast<uint32_t>(registry.Infos.size());
+    }
+}
@@ -73,6 +73,11 @@ namespace pulsar
         return ret;
     }
 
+    Matrix4f SceneCapture2DComponent::GetViewProjectionMat() const
+    {
+        return GetProjectionMat() * GetViewMat();
+    }
+
     Matrix4f SceneCapture2DComponent::GetInvViewProjectionMat() const
     {
         return Inverse(GetViewMat()) * Inverse(GetProjectionMat());
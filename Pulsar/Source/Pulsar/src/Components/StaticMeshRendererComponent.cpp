@@ -11,16 +11,14 @@
 
 namespace pulsar
 {
-    static gfx::GFXDescriptorSetLayout_wp MeshDescriptorSetLayout;
-
     class StaticMeshRenderObject final : public rendering::RenderObject
     {
     public:
         array_list<rendering::MeshBatch> m_batchs;
         RCPtr<StaticMesh> m_staticMesh;
         array_list<RCPtr<Material>> m_materials;
+        bool m_isInstancing{};
 
-        gfx::GFXBuffer_sp m_meshConstantBuffer;
         gfx::GFXDescriptorSet_sp m_meshObjDescriptorSet;
         gfx::GFXDescriptorSetLayout_sp m_meshDescriptorSetLayout;
 
@@ -39,22 +37,31 @@ namespace pulsar
             m_materials = materials;
             return this;
         }
+        StaticMeshRenderObject* SetInstancing(bool value)
+        {
+            m_isInstancing = value;
+            return this;
+        }
         void SubmitChange();
         void OnCreateResource() override;
         void OnDestroyResource() override
         {
             m_meshObjDescriptorSet.reset();
             m_meshDescriptorSetLayout.reset();
-            m_meshConstantBuffer.reset();
         }
 
         void OnChangedTransform() override
         {
+            bool isChangedCulling = false;
             for (auto& batch : m_batchs)
             {
+                isChangedCulling |= batch.IsReverseCulling != IsDetermiantNegative();
                 batch.IsReverseCulling = IsDetermiantNegative();
             }
-            m_meshConstantBuffer->Fill(&m_perModelData);
+            if (isChangedCulling)
+            {
+                SubmitBatchsChanged();
+            }
         }
 
         array_list<rendering::MeshBatch> GetMeshBatchs() override
@@ -67,7 +74,10 @@ namespace pulsar
         m_batchs.clear();
 
         if (!m_staticMesh)
+        {
+            SubmitBatchsChanged();
             return;
+        }
 
         for (auto& mat : m_materials)
         {
@@ -105,29 +115,17 @@ namespace pulsar
                 element.Indices = indicesBuffers[i];
                 element.ModelDescriptor = m_meshObjDescriptorSet;
             }
+            batch.IsReverseCulling = IsDetermiantNegative();
+            batch.IsInstancing = m_isInstancing;
         }
+
+        SubmitBatchsChanged();
     }
 
     void StaticMeshRenderObject::OnCreateResource()
     {
-        if (MeshDescriptorSetLayout.expired())
-        {
-            gfx::GFXDescriptorSetLayoutInfo info{
-                gfx::GFXDescriptorType::ConstantBuffer,
-                gfx::GFXShaderStageFlags::VertexFragment,
-                0, kRenderingDescriptorSpace_ModelInfo};
-            m_meshDescriptorSetLayout = Application::GetGfxApp()->CreateDescriptorSetLayout(&info, 1);
-            MeshDescriptorSetLayout = m_meshDescriptorSetLayout;
-        }
-        else
-        {
-            m_meshDescriptorSetLayout = MeshDescriptorSetLayout.lock();
-        }
-
-        m_meshConstantBuffer = Application::GetGfxApp()->CreateBuffer(gfx::GFXBufferUsage::ConstantBuffer, sizeof(CBuffer_ModelObject));
-        m_meshObjDescriptorSet = Application::GetGfxApp()->GetDescriptorManager()->GetDescriptorSet(m_meshDescriptorSetLayout);
-        m_meshObjDescriptorSet->AddDescriptor("ModelObject", 0)->SetConstantBuffer(m_meshConstantBuffer.get());
-        m_meshObjDescriptorSet->Submit();
+        m_meshDescriptorSetLayout = GetModelDescriptorSetLayout();
+        m_meshObjDescriptorSet = GetModelDescriptorSet();
 
         SubmitChange();
     }
@@ -150,6 +148,7 @@ namespace pulsar
             }
             ro->SetStaticMesh(m_staticMesh)
                 ->SetMaterials(*m_materials)
+                ->SetInstancing(m_isInstancing)
                 ->SubmitChange();
         }
         return ro;
@@ -170,6 +169,10 @@ namespace pulsar
             }
             OnMaterialChanged();
         }
+        else if (info->GetName() == NAMEOF(m_isInstancing))
+        {
+            SetInstancing(m_isInstancing);
+        }
     }
     StaticMeshRendererComponent::StaticMeshRendererComponent() :
         CORELIB_INIT_INTERFACE(IRendererComponent)
@@ -179,16 +182,22 @@ namespace pulsar
 
     BoxSphereBounds3f StaticMeshRendererComponent::GetBoundsWS()
     {
+        if (!m_staticMesh)
+        {
+            return {};
+        }
         auto srcBounds = m_staticMesh->GetBounds();
-        auto box = srcBounds.GetBox();
-        auto sphere = srcBounds.GetSphere();
 
-        auto mat = GetTransform()->GetLocalToWorldMatrix();
-        box.Min = mat * box.Min;
-        box.Max = mat * box.Max;
+        auto& mat = GetTransform()->GetLocalToWorldMatrix();
+
+        // project the local extent onto the world axes, keeps the box conservative under rotation
+        auto extent =
+            jmath::Abs(mat[0].xyz()) * srcBounds.Extent.x +
+            jmath::Abs(mat[1].xyz()) * srcBounds.Extent.y +
+            jmath::Abs(mat[2].xyz()) * srcBounds.Extent.z;
 
-        sphere.Radius = jmath::MaxComponent(jmath::Abs(GetTransform()->GetWorldScale())) * srcBounds.Radius;
-        return BoxSphereBounds3f{box, sphere};
+        auto radius = jmath::MaxComponent(jmath::Abs(GetTransform()->GetWorldScale())) * srcBounds.Radius;
+        return BoxSphereBounds3f{mat * srcBounds.Origin, extent, radius};
     }
 
     void StaticMeshRendererComponent::SetStaticMesh(RCPtr<StaticMesh> staticMesh)
@@ -205,6 +214,14 @@ namespace pulsar
 
         OnMeshChanged();
     }
+    void StaticMeshRendererComponent::SetInstancing(bool value)
+    {
+        m_isInstancing = value;
+        if (m_renderObject)
+        {
+            m_renderObject->SetInstancing(m_isInstancing)->SubmitChange();
+        }
+    }
     RCPtr<StaticMesh> StaticMeshRendererComponent::GetMaterial(int index) const
     {
         return m_materials->at(index);
@@ -360,6 +377,22 @@ namespace pulsar
     {
         base::OnTransformChanged();
         m_renderObject->SetTransform(GetNode()->GetTransform()->GetLocalToWorldMatrix());
+        UpdateRenderObjectBounds();
+    }
+    void StaticMeshRendererComponent::UpdateRenderObjectBounds()
+    {
+        if (!m_renderObject)
+        {
+            return;
+        }
+        if (m_staticMesh)
+        {
+            m_renderObject->SetBoundsWS(GetBoundsWS());
+        }
+        else
+        {
+            m_renderObject->ClearBounds();
+        }
     }
     void StaticMeshRendererComponent::OnMeshChanged()
     {
@@ -376,6 +409,7 @@ namespace pulsar
         if (m_renderObject)
         {
             m_renderObject->SetStaticMesh(m_staticMesh)->SubmitChange();
+            UpdateRenderObjectBounds();
         }
     }
     void StaticMeshRendererComponent::OnMaterialChanged()
@@ -3,6 +3,7 @@
 #include "TransformUtil.h"
 
 #include <Pulsar/Node.h>
+#include <Pulsar/World.h>
 
 namespace pulsar
 {
@@ -152,6 +153,22 @@ namespace pulsar
     void TransformComponent::BeginComponent()
     {
         base::BeginComponent();
+        if (auto world = GetWorld())
+        {
+            m_transformManager = &world->GetTransformManager();
+            m_transformHandle = m_transformManager->Register(this);
+        }
+    }
+    void TransformComponent::EndComponent()
+    {
+        if (m_transformManager)
+        {
+            m_transformManager->Unregister(m_transformHandle);
+            m_transformManager = nullptr;
+            m_transformHandle = TransformManager::kInvalidHandle;
+            m_isDirtyMatrix = true;
+        }
+        base::EndComponent();
     }
 
     static Matrix4f RootIdentMat{1};
@@ -179,25 +196,24 @@ namespace pulsar
     }
     const Matrix4f& TransformComponent::GetLocalToWorldMatrix()
     {
+        if (m_transformManager)
+        {
+            return m_transformManager->GetLocalToWorldMatrix(m_transformHandle);
+        }
         if (m_isDirtyMatrix)
             RebuildLocalToWorldMatrix();
         return m_localToWorldMatrix;
     }
     const Matrix4f& TransformComponent::GetWorldToLocalMatrix()
     {
+        if (m_transformManager)
+        {
+            return m_transformManager->GetWorldToLocalMatrix(m_transformHandle);
+        }
         if (m_isDirtyMatrix)
             RebuildLocalToWorldMatrix();
         return m_worldToLocalMatrix;
     }
-    void TransformComponent::OnTransformChanged()
-    {
-        base::OnTransformChanged();
-        for (auto& childTransform : *this->m_children)
-        {
-            childTransform->MakeTransformChanged();
-        }
-    }
-
     void TransformComponent::RebuildLocalToWorldMatrix()
     {
         transutil::NewTRS(m_localToWorldMatrix, m_position, m_rotation, m_scale);
@@ -234,10 +250,14 @@ namespace pulsar
 
     void TransformComponent::MakeTransformChanged()
     {
-        m_isDirtyMatrix = true;
-        if (m_beginning)
+        // children and the node's components are notified by the world store on its next update
+        if (m_transformManager)
         {
-            GetNode()->OnTransformChanged();
+            m_transformManager->SetLocalTransform(m_transformHandle, m_position, m_rotation, m_scale);
+        }
+        else
+        {
+            m_isDirtyMatrix = true;
         }
     }
 
@@ -260,5 +280,12 @@ namespace pulsar
             m_parent = parent;
             m_parent->m_children->push_back(THIS_REF);
         }
+
+        if (m_transformManager)
+        {
+            m_transformManager->MarkHierarchyChanged();
+        }
+        MakeTransformChanged();
+        GetNode()->OnParentActiveChanged();
     }
 } // namespace pulsar
\ No newline at end of file
@@ -0,0 +1,621 @@
+#include <Pulsar/CookedAssetPackage.h>
+#include <Pulsar/Application.h>
+#include <Pulsar/IGPUResource.h>
+#include <Pulsar/Logger.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+namespace pulsar
+{
+    // resource data is aligned for typed reads of bulk data
+    static constexpr uint64_t kResourceAlignment = 16;
+
+    static uint64_t AlignResourceOffset(uint64_t offset)
+    {
+        return (offset + kResourceAlignment - 1) & ~(kResourceAlignment - 1);
+    }
+
+    uint32_t CookedAssetPackageWriter::AddResource(CookedResourceType type, ObjectHandle handle, string data)
+    {
+        m_resources.push_back({type, handle, std::move(data)});
+        // the index in the file, where the asset index takes resource 0
+        return static_cast<uint32_t>(m_resources.size());
+    }
+
+    void CookedAssetPackageWriter::AddAsset(AssetObject* asset, string_view path)
+    {
+        auto objser = ser::CreateVarient("msgpack");
+        std::stringstream bulk{std::ios::in | std::ios::out | std::ios::binary};
+
+        AssetSerializer serializer{objser, bulk, true, false};
+        serializer.CookedOnly = true;
+        serializer.ExistStream = true;
+        asset->Serialize(&serializer);
+
+        CookedAssetInfo info;
+        info.Handle = asset->GetObjectHandle();
+        info.Path = path;
+        info.TypeName = asset->GetType()->GetName();
+        info.ObjectResource = AddResource(CookedResourceType::ObjectData, info.Handle, objser->ToString());
+
+        auto bulkData = bulk.str();
+        if (!bulkData.empty())
+        {
+            info.BulkResource = AddResource(CookedResourceType::BulkData, info.Handle, std::move(bulkData));
+        }
+        m_assets.push_back(std::move(info));
+    }
+
+    void CookedAssetPackageWriter::Write(std::ostream& stream) const
+    {
+        auto index = ser::CreateVarient("msgpack");
+        index->Assign(index->New(ser::VarientType::Array));
+        for (const auto& asset : m_assets)
+        {
+            auto item = index->New(ser::VarientType::Object);
+            item->Add("Path", asset.Path);
+            item->Add("Type", asset.TypeName);
+            item->Add("Object", static_cast<int>(asset.ObjectResource));
+            item->Add("Bulk", asset.BulkResource == CookedAssetInfo::kNoResource ? -1 : static_cast<int>(asset.BulkResource));
+            index->Push(item);
+        }
+        const auto indexData = index->ToString();
+
+        // the index is always the first resource
+        const auto resourceCount = m_resources.size() + 1;
+        auto getData = [&](size_t i) -> const string& { return i == 0 ? indexData : m_resources[i - 1].Data; };
+
+        binf::BinaryFileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(&header.Magic, kCookedPackageMagic, sizeof(header.Magic));
+        header.Version = kCookedPackageVersion;
+        header.ResourceCount = resourceCount;
+        header.ResourceTableOffset = sizeof(binf::BinaryFileHeader);
+        header.DataOffset = AlignResourceOffset(header.ResourceTableOffset + resourceCount * sizeof(binf::BinaryResourceInfo));
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        uint64_t offset = 0;
+        for (size_t i = 0; i < resourceCount; ++i)
+        {
+            binf::BinaryResourceInfo info;
+            std::memset(&info, 0, sizeof(info));
+            if (i == 0)
+            {
+                info.Type = static_cast<uint32_t>(CookedResourceType::Index);
+            }
+            else
+            {
+                const auto& resource = m_resources[i - 1];
+                info.Type = static_cast<uint32_t>(resource.Type);
+                static_assert(sizeof(ObjectHandle) == sizeof(info.Hash128));
+                std::memcpy(&info.Hash128, &resource.Handle, sizeof(info.Hash128));
+            }
+            info.Version = kCookedPackageVersion;
+            info.Offset = offset;
+            info.Length = getData(i).size();
+            offset = AlignResourceOffset(offset + info.Length);
+            stream.write(reinterpret_cast<const char*>(&info), sizeof(info));
+        }
+
+        const char padding[kResourceAlignment]{};
+        auto position = header.ResourceTableOffset + resourceCount * sizeof(binf::BinaryResourceInfo);
+        stream.write(padding, static_cast<std::streamsize>(header.DataOffset - position));
+        position = 0;
+        for (size_t i = 0; i < resourceCount; ++i)
+        {
+            const auto& data = getData(i);
+            stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+            position += data.size();
+            const auto aligned = AlignResourceOffset(position);
+            stream.write(padding, static_cast<std::streamsize>(aligned - position));
+            position = aligned;
+        }
+    }
+
+    namespace
+    {
+        // istream over mapped memory, reads copy straight out of the mapping
+        class MemoryStreamBuffer : public std::streambuf
+        {
+        public:
+            MemoryStreamBuffer(const uint8_t* data, size_t size)
+            {
+                auto begin = reinterpret_cast<char*>(const_cast<uint8_t*>(data));
+                setg(begin, begin, begin + size);
+            }
+        protected:
+            pos_type seekoff(off_type off, std::ios::seekdir dir, std::ios::openmode which) override
+            {
+                if (!(which & std::ios::in))
+                {
+                    return pos_type(off_type(-1));
+                }
+                char* base = dir == std::ios::beg ? eback() : dir == std::ios::cur ? gptr() : egptr();
+                char* target = base + off;
+                if (target < eback() || target > egptr())
+                {
+                    return pos_type(off_type(-1));
+                }
+                setg(eback(), target, egptr());
+                return pos_type(target - eback());
+            }
+            pos_type seekpos(pos_type pos, std::ios::openmode which) override
+            {
+                return seekoff(off_type(pos), std::ios::beg, which);
+            }
+        };
+    }
+
+    std::unique_ptr<CookedAssetPackage> CookedAssetPackage::Open(const std::filesystem::path& path)
+    {
+        auto file = MappedFile::Open(path);
+        if (!file)
+        {
+            return nullptr;
+        }
+
+        binf::BinaryFileHeader header;
+        if (file->GetSize() < sizeof(header))
+        {
+            Logger::Log("invalid cooked package: " + path.string(), LogLevel::Error);
+            return nullptr;
+        }
+        std::memcpy(&header, file->GetData(), sizeof(header));
+        // compared without adding, damaged offsets must not wrap around
+        const auto fileSize = file->GetSize();
+        if (std::memcmp(&header.Magic, kCookedPackageMagic, sizeof(header.Magic)) != 0
+            || header.Version != kCookedPackageVersion
+            || header.ResourceCount == 0
+            || header.ResourceTableOffset > fileSize
+            || header.ResourceCount > (fileSize - header.ResourceTableOffset) / sizeof(binf::BinaryResourceInfo)
+            || header.DataOffset > fileSize)
+        {
+            Logger::Log("invalid cooked package: " + path.string(), LogLevel::Error);
+            return nullptr;
+        }
+
+        auto package = std::make_unique<CookedAssetPackage>();
+        package->m_file = std::move(file);
+        package->m_resources = reinterpret_cast<const binf::BinaryResourceInfo*>(package->m_file->GetData() + header.ResourceTableOffset);
+        package->m_resourceCount = header.ResourceCount;
+        package->m_dataOffset = header.DataOffset;
+
+        // a damaged index fails the package, not the mount
+        try
+        {
+            if (!package->ReadIndex(path))
+            {
+                return nullptr;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Logger::Log("invalid cooked package index: " + path.string() + ", " + e.what(), LogLevel::Error);
+            return nullptr;
+        }
+        return package;
+    }
+
+    bool CookedAssetPackage::ReadIndex(const std::filesystem::path& path)
+    {
+        const auto indexData = GetResource(0);
+        auto index = ser::CreateVarient("msgpack");
+        index->AssignParse({reinterpret_cast<const char*>(indexData.Data), indexData.Size});
+
+        const auto count = index->GetCount();
+        m_assets.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto item = index->At(i);
+            auto pathItem = item ? item->At("Path") : nullptr;
+            auto typeItem = item ? item->At("Type") : nullptr;
+            auto objectItem = item ? item->At("Object") : nullptr;
+            auto bulkItem = item ? item->At("Bulk") : nullptr;
+            if (!pathItem || !typeItem || !objectItem || !bulkItem)
+            {
+                Logger::Log("invalid cooked package, incomplete asset entry " + std::to_string(i) + ": " + path.string(), LogLevel::Error);
+                return false;
+            }
+            auto& info = m_assets.emplace_back();
+            info.Path = pathItem->AsString();
+            info.TypeName = typeItem->AsString();
+            const auto object = objectItem->AsInt();
+            const auto bulk = bulkItem->AsInt();
+            // resource 0 is the index itself, a bulk of -1 means none
+            if (object <= 0 || static_cast<size_t>(object) >= m_resourceCount ||
+                bulk == 0 || (bulk > 0 && static_cast<size_t>(bulk) >= m_resourceCount))
+            {
+                Logger::Log("invalid cooked package, asset resource out of range: " + info.Path + ", " + path.string(), LogLevel::Error);
+                return false;
+            }
+            info.ObjectResource = static_cast<uint32_t>(object);
+            info.BulkResource = bulk < 0 ? CookedAssetInfo::kNoResource : static_cast<uint32_t>(bulk);
+            // the handle is kept in the resource table
+            std::memcpy(&info.Handle, &m_resources[info.ObjectResource].Hash128, sizeof(info.Handle));
+
+            m_pathIndices.emplace(info.Path, i);
+            m_handleIndices.emplace(info.Handle, i);
+        }
+        return true;
+    }
+
+    const CookedAssetInfo* CookedAssetPackage::FindAsset(string_view path) const
+    {
+        auto it = m_pathIndices.find(string{path});
+        return it == m_pathIndices.end() ? nullptr : &m_assets[it->second];
+    }
+
+    const CookedAssetInfo* CookedAssetPackage::FindAsset(ObjectHandle handle) const
+    {
+        auto it = m_handleIndices.find(handle);
+        return it == m_handleIndices.end() ? nullptr : &m_assets[it->second];
+    }
+
+    BulkDataView CookedAssetPackage::GetResource(uint32_t index) const
+    {
+        if (index >= m_resourceCount)
+        {
+            throw EngineException("cooked resource index out of range");
+        }
+        const auto& info = m_resources[index];
+        // the data offset was checked against the size on open, the rest is compared without adding
+        const auto dataSize = m_file->GetSize() - m_dataOffset;
+        if (info.Offset > dataSize || info.Length > dataSize - info.Offset)
+        {
+            throw EngineException("cooked resource out of the package range");
+        }
+        const auto offset = m_dataOffset + info.Offset;
+        return {m_file, m_file->GetData() + offset, static_cast<size_t>(info.Length)};
+    }
+
+    CookedAssetData CookedAssetPackage::ReadAsset(const CookedAssetInfo& info) const
+    {
+        CookedAssetData data;
+        // parsed in place from the mapping
+        const auto objectData = GetResource(info.ObjectResource);
+        data.Object = ser::CreateVarient("msgpack");
+        data.Object->AssignParse({reinterpret_cast<const char*>(objectData.Data), objectData.Size});
+        if (info.BulkResource != CookedAssetInfo::kNoResource)
+        {
+            data.Bulk = GetResource(info.BulkResource);
+        }
+        return data;
+    }
+
+    RCPtr<AssetObject> CookedAssetPackage::LoadAsset(const CookedAssetInfo& info)
+    {
+        if (auto existObj = RuntimeObjectManager::GetObject(info.Handle))
+        {
+            return static_cast<AssetObject*>(existObj);
+        }
+        return LoadAsset(info, ReadAsset(info));
+    }
+
+    RCPtr<AssetObject> CookedAssetPackage::LoadAsset(const CookedAssetInfo& info, const CookedAssetData& data)
+    {
+        if (auto existObj = RuntimeObjectManager::GetObject(info.Handle))
+        {
+            return static_cast<AssetObject*>(existObj);
+        }
+
+        auto type = AssemblyManager::GlobalFindType(info.TypeName);
+        if (!type)
+        {
+            Logger::Log("not found type: " + info.TypeName, LogLevel::Error);
+            return nullptr;
+        }
+        SPtr<AssetObject> assetObj = sptr_cast<AssetObject>(type->CreateSharedInstance({}));
+
+        const auto nameIndex = info.Path.find_last_of('/');
+        assetObj->SetName(nameIndex == string::npos ? info.Path : info.Path.substr(nameIndex + 1));
+        assetObj->Construct(info.Handle);
+
+        MemoryStreamBuffer buffer{data.Bulk.Data, data.Bulk.Size};
+        std::iostream bulk{&buffer};
+
+        AssetSerializer serializer{data.Object, bulk, false, false};
+        serializer.CookedOnly = true;
+        serializer.ExistStream = data.Bulk.IsValid();
+        serializer.MappedBulkData = data.Bulk;
+        assetObj->Serialize(&serializer);
+
+        // backed by the package like an editor asset by its file, destroying it keeps the slot for a reload
+        assetObj->SetObjectFlags(assetObj->GetObjectFlags() | OF_Persistent);
+
+        return assetObj;
+    }
+
+    CookedAssetManager::~CookedAssetManager()
+    {
+        {
+            std::lock_guard lock{m_mutex};
+            for (auto& queued : m_queue)
+            {
+                queued.Request->Cancel();
+            }
+        }
+        // queued jobs still reference the manager
+        if (auto jobSystem = Application::GetJobSystem())
+        {
+            jobSystem->Wait(m_jobs);
+        }
+    }
+
+    bool CookedAssetManager::Mount(const std::filesystem::path& path)
+    {
+        auto package = CookedAssetPackage::Open(path);
+        if (!package)
+        {
+            return false;
+        }
+        m_packages.push_back(std::move(package));
+        return true;
+    }
+
+    void CookedAssetManager::MountFolder(const std::filesystem::path& folder)
+    {
+        if (!std::filesystem::is_directory(folder))
+        {
+            return;
+        }
+        for (const auto& file : std::filesystem::directory_iterator(folder))
+        {
+            if (file.is_regular_file() && file.path().extension() == kCookedPackageExt)
+            {
+                Mount(file.path());
+            }
+        }
+    }
+
+    RCPtr<AssetObject> CookedAssetManager::Load(CookedAssetPackage* package, const CookedAssetInfo& info, const CookedAssetData* data)
+    {
+        std::shared_ptr<LoadState> state;
+        {
+            std::lock_guard lock{m_mutex};
+            auto& slot = m_loading[info.Handle];
+            if (!slot)
+            {
+                slot = std::make_shared<LoadState>();
+            }
+            state = slot;
+        }
+
+        RCPtr<AssetObject> asset;
+        {
+            std::lock_guard lock{state->Mutex};
+            if (!state->IsLoaded)
+            {
+                state->Asset = data ? package->LoadAsset(info, *data) : package->LoadAsset(info);
+                state->IsLoaded = true;
+            }
+            asset = state->Asset;
+        }
+
+        // later loads find the object in the RuntimeObjectManager
+        std::lock_guard lock{m_mutex};
+        auto it = m_loading.find(info.Handle);
+        if (it != m_loading.end() && it->second == state)
+        {
+            m_loading.erase(it);
+        }
+        return asset;
+    }
+
+    bool CookedAssetManager::FindAsset(const AssetLoadRequest& request, CookedAssetPackage*& package, const CookedAssetInfo*& info) const
+    {
+        for (const auto& item : m_packages)
+        {
+            info = request.Path.empty() ? item->FindAsset(request.Handle) : item->FindAsset(request.Path);
+            if (info)
+            {
+                package = item.get();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    RCPtr<AssetObject> CookedAssetManager::LoadAssetAtPath(string_view path)
+    {
+        for (const auto& package : m_packages)
+        {
+            if (auto info = package->FindAsset(path))
+            {
+                return Load(package.get(), *info);
+            }
+        }
+        return nullptr;
+    }
+
+    RCPtr<AssetObject> CookedAssetManager::LoadAssetById(ObjectHandle id)
+    {
+        for (const auto& package : m_packages)
+        {
+            if (auto info = package->FindAsset(id))
+            {
+                return Load(package.get(), *info);
+            }
+        }
+        return nullptr;
+    }
+
+    AssetLoadHandle CookedAssetManager::LoadAssetAsync(string_view path, AssetLoadPriority priority)
+    {
+        auto request = std::make_shared<AssetLoadRequest>();
+        request->Path = path;
+        request->Priority = priority;
+        Enqueue(request);
+        return request;
+    }
+
+    AssetLoadHandle CookedAssetManager::LoadAssetAsync(ObjectHandle id, AssetLoadPriority priority)
+    {
+        auto request = std::make_shared<AssetLoadRequest>();
+        request->Handle = id;
+        request->Priority = priority;
+        Enqueue(request);
+        return request;
+    }
+
+    static constexpr auto _CompareQueuedRequest = [](const auto& a, const auto& b)
+    {
+        if (a.Request->Priority != b.Request->Priority)
+        {
+            return a.Request->Priority < b.Request->Priority;
+        }
+        return a.Sequence > b.Sequence;
+    };
+
+    void CookedAssetManager::Enqueue(AssetLoadHandle request)
+    {
+        auto jobSystem = Application::GetJobSystem();
+        if (!jobSystem)
+        {
+            auto upload = ProcessRequest(std::move(request));
+            std::lock_guard lock{m_mutex};
+            m_uploads.push_back(std::move(upload));
+            return;
+        }
+
+        {
+            std::lock_guard lock{m_mutex};
+            m_queue.push_back({std::move(request), m_sequence++});
+            std::push_heap(m_queue.begin(), m_queue.end(), _CompareQueuedRequest);
+        }
+        // the job system is fifo, each job takes the best request when it starts
+        jobSystem->Schedule([this] { RunNext(); }, &m_jobs);
+    }
+
+    void CookedAssetManager::RunNext()
+    {
+        AssetLoadHandle request;
+        {
+            std::lock_guard lock{m_mutex};
+            if (m_queue.empty())
+            {
+                return;
+            }
+            std::pop_heap(m_queue.begin(), m_queue.end(), _CompareQueuedRequest);
+            request = std::move(m_queue.back().Request);
+            m_queue.pop_back();
+        }
+
+        auto upload = ProcessRequest(std::move(request));
+
+        std::lock_guard lock{m_mutex};
+        m_uploads.push_back(std::move(upload));
+    }
+
+    CookedAssetManager::Upload CookedAssetManager::ProcessRequest(AssetLoadHandle request)
+    {
+        Upload upload;
+        upload.Request = std::move(request);
+        auto& req = *upload.Request;
+        if (req.IsCancelled.load(std::memory_order_acquire))
+        {
+            return upload;
+        }
+        req.Status.store(AssetLoadStatus::Loading, std::memory_order_release);
+
+        // only the data is read here, the object is created by Tick on the main thread
+        if (FindAsset(req, upload.Package, upload.Info) && !RuntimeObjectManager::GetObject(upload.Info->Handle))
+        {
+            try
+            {
+                upload.Data = upload.Package->ReadAsset(*upload.Info);
+            }
+            catch (const std::exception& e)
+            {
+                Logger::Log("read asset failed: " + upload.Info->Path + ", " + e.what(), LogLevel::Error);
+                upload.Package = nullptr;
+            }
+        }
+        // Tick decides between completed, failed and cancelled
+        req.Status.store(AssetLoadStatus::Uploading, std::memory_order_release);
+        return upload;
+    }
+
+    void CookedAssetManager::FinishUpload(Upload& upload)
+    {
+        auto& request = *upload.Request;
+
+        AssetLoadStatus status;
+        if (request.IsCancelled.load(std::memory_order_acquire))
+        {
+            request.Asset = nullptr;
+            status = AssetLoadStatus::Cancelled;
+        }
+        else
+        {
+            if (upload.Package)
+            {
+                try
+                {
+                    request.Asset = Load(upload.Package, *upload.Info, upload.Data ? &*upload.Data : nullptr);
+                }
+                catch (const std::exception& e)
+                {
+                    Logger::Log("load asset failed: " + upload.Info->Path + ", " + e.what(), LogLevel::Error);
+                    request.Asset = nullptr;
+                }
+            }
+
+            if (!request.Asset)
+            {
+                status = AssetLoadStatus::Failed;
+            }
+            else
+            {
+                if (auto gpuResource = dynamic_cast<IGPUResource*>(request.Asset.GetPtr()))
+                {
+                    if (!gpuResource->IsCreatedGPUResource())
+                    {
+                        gpuResource->CreateGPUResource();
+                    }
+                }
+                status = AssetLoadStatus::Completed;
+            }
+        }
+        request.Status.store(status, std::memory_order_release);
+        if (request.OnDone)
+        {
+            request.OnDone(request);
+        }
+    }
+
+    void CookedAssetManager::Tick()
+    {
+        using clock = std::chrono::steady_clock;
+        const auto begin = clock::now();
+        const auto budget = std::chrono::microseconds{m_uploadBudget};
+
+        while (true)
+        {
+            Upload upload;
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_uploads.empty())
+                {
+                    break;
+                }
+                upload = std::move(m_uploads.front());
+                m_uploads.pop_front();
+            }
+
+            FinishUpload(upload);
+
+            if (m_uploadBudget != 0 && clock::now() - begin >= budget)
+            {
+                break;
+            }
+        }
+    }
+
+    size_t CookedAssetManager::GetPendingCount()
+    {
+        std::lock_guard lock{m_mutex};
+        return m_queue.size() + m_uploads.size();
+    }
+}
@@ -4,14 +4,19 @@
 #include "Components/StaticMeshRendererComponent.h"
 #include "Rendering/LightingData.h"
 #include "Rendering/RenderObject.h"
+#include "Rendering/ViewCulling.h"
 #include "Scene.h"
 
 #include <Pulsar/Application.h>
 #include <Pulsar/EngineAppInstance.h>
 #include <Pulsar/ImGuiImpl.h>
+#include <Pulsar/JobSystem.h>
 #include <Pulsar/Logger.h>
+#include <Pulsar/Node.h>
 #include <Pulsar/World.h>
 #include <filesystem>
+#include <format>
+#include <gfx-null/GFXNullApplication.h>
 
 namespace pulsar
 {
@@ -25,59 +30,82 @@ namespace pulsar
     }
 
 
-    void EngineRenderPipeline::OnRender(
-        gfx::GFXRenderContext* context, gfx::GFXFrameBufferObject* backbuffer)
+    namespace
     {
-        auto& cmdBuffer = context->GetCommandBuffer(0);
-
-        for (auto world : m_worlds)
+        struct CameraRenderJob
+        {
+            World* TargetWorld;
+            CameraComponent* Camera;
+            rendering::ViewCulling Culling;
+            uint32_t ViewId;
+            size_t CommandBufferIndex;
+        };
+
+        struct FrameRenderData
         {
+            gfx::GFXGraphicsPipelineManager* PipelineManager;
+            gfx::GFXDynamicBuffer* DynamicBuffer;
+            gfx::GFXDescriptorSet_sp ModelDescriptorSet;
+            size_t MaxInstancesPerDraw;
+            gfx::GFXDescriptorSetLayout_sp PostProcessDescLayout;
+        };
+
+        // records one camera into its own command buffer, runs on job threads.
+        // everything shared between cameras has to be prepared before, see EngineRenderPipeline::OnRender
+        void RecordCamera(gfx::GFXCommandBuffer& cmdBuffer, const CameraRenderJob& job, const FrameRenderData& frame)
+        {
+            const auto world = job.TargetWorld;
+            const auto cam = job.Camera;
             auto& renderObjects = world->GetRenderObjects();
+            auto& batchCache = world->GetMeshBatchCache();
+            auto pipelineMgr = frame.PipelineManager;
+            auto dynamicBuffer = frame.DynamicBuffer;
 
-            auto pipelineMgr = context->GetApplication()->GetGraphicsPipelineManager();
+            cmdBuffer.Begin();
 
-            for (const auto& cam : world->GetCameraManager().GetCameras())
+            auto targetFBO = cam->GetRenderTexture()->GetGfxFrameBufferObject().get();
+
+            cmdBuffer.SetFrameBuffer(targetFBO);
+
+            for (auto& rt : targetFBO->GetRenderTargets())
             {
-                auto targetFBO = cam->GetRenderTexture()->GetGfxFrameBufferObject().get();
+                cmdBuffer.CmdClearColor(rt->GetTexture());
+            }
 
-                cmdBuffer.SetFrameBuffer(targetFBO);
+            cmdBuffer.CmdBeginFrameBuffer();
+            cmdBuffer.CmdSetViewport(0, 0, (float)targetFBO->GetWidth(), (float)targetFBO->GetHeight());
 
-                for (auto& rt : targetFBO->GetRenderTargets())
-                {
-                    cmdBuffer.CmdClearColor(rt->GetTexture());
-                }
+            // culling
+            const uint32_t viewId = job.ViewId;
+            rendering::ViewCullingStats cullingStats{};
+            job.Culling.Cull(renderObjects, viewId, &cullingStats);
+            cam->SetCullingStats(cullingStats);
 
-                cmdBuffer.CmdBeginFrameBuffer();
-                cmdBuffer.CmdSetViewport(0, 0, (float)targetFBO->GetWidth(), (float)targetFBO->GetHeight());
+            // batch render
+            const auto& modelDescriptorSet = frame.ModelDescriptorSet;
+            const auto maxInstancesPerDraw = frame.MaxInstancesPerDraw;
+            array_list<rendering::RenderObject*> visibleInstances;
 
-                // combine batches
-                std::unordered_map<size_t, rendering::MeshBatch> batches;
-                for (const rendering::RenderObject_sp& renderObject : renderObjects)
+            for (const auto cachedBatch : batchCache.GetBatches())
+            {
+                auto& batch = cachedBatch->Batch;
+                if (batch.Material->GetShader()->GetConfig()->RenderingType == ShaderPassRenderingType::PostProcessing)
                 {
-                    for (auto& batch : renderObject->GetMeshBatchs())
-                    {
-                        auto stateHash = batch.GetRenderState();
-                        if (batches.contains(stateHash))
-                        {
-                            batches[stateHash].Append(batch);
-                        }
-                        else
-                        {
-                            batches[stateHash] = batch;
-                        }
-                    }
+                    continue;
                 }
 
-                // batch render
-                for (auto& [state, batch] : batches)
-                {
-                    auto shaderPass = batch.Material->GetGfxShaderPass();
-                    if (batch.Material->GetShader()->GetConfig()->RenderingType == ShaderPassRenderingType::PostProcessing)
+                std::shared_ptr<gfx::GFXGraphicsPipeline> gfxPipeline;
+                array_list<gfx::GFXDescriptorSet*> descriptorSets;
+
+                // bind render state at the first visible element
+                auto bindPipeline = [&] {
+                    if (gfxPipeline)
                     {
-                        continue;
+                        return;
                     }
+                    auto shaderPass = batch.Material->GetGfxShaderPass();
+                    const auto materialDesc = batch.Material->GetGfxDescriptorSet().get();
 
-                    // bind render state
                     array_list<gfx::GFXDescriptorSetLayout_sp> descriptorSetLayouts;
 
                     for (auto& refData : targetFBO->RefData)
@@ -87,176 +115,285 @@ namespace pulsar
                     descriptorSetLayouts.push_back(world->GetWorldDescriptorSet()->GetDescriptorSetLayout());
                     descriptorSetLayouts.push_back(world->GetLightManager()->GetDescriptorSetLayout());
                     descriptorSetLayouts.push_back(batch.DescriptorSetLayout);
-                    if (batch.Material->GetGfxDescriptorSet()->GetDescriptorCount() != 0)
+                    if (materialDesc->GetDescriptorCount() != 0)
                     {
                         descriptorSetLayouts.push_back(batch.Material->GetGfxDescriptorSetLayout());
                     }
 
-                    auto gfxPipeline = pipelineMgr->GetGraphicsPipeline(shaderPass, descriptorSetLayouts, targetFBO->GetRenderPassLayout(), batch.State);
+                    gfxPipeline = pipelineMgr->GetGraphicsPipeline(shaderPass, descriptorSetLayouts, targetFBO->GetRenderPassLayout(), batch.State);
                     cmdBuffer.CmdBindGraphicsPipeline(gfxPipeline.get());
                     cmdBuffer.CmdSetCullMode(batch.GetCullMode());
 
-                    for (auto& element : batch.Elements)
+                    // the sets are the same for the whole batch, only the model data offset changes
+                    // setup 0. per cam
+                    for (auto& refData : targetFBO->RefData)
+                    {
+                        descriptorSets.push_back(refData.lock().get());
+                    }
+                    // setup 1. world
+                    descriptorSets.push_back(world->GetWorldDescriptorSet().get());
+                    // setup 2. light data
+                    descriptorSets.push_back(world->GetLightManager()->GetDescriptorSet().get());
+                    // setup 3. per renderer, model data in the frame dynamic buffer
+                    descriptorSets.push_back(modelDescriptorSet.get());
+                    // setup 4. per material
+                    if (materialDesc->GetDescriptorCount() != 0)
+                    {
+                        descriptorSets.push_back(materialDesc);
+                    }
+                };
+
+                // the command buffer skips the sets that are already bound
+                auto bindDescriptorSets = [&](uint32_t modelDataOffset) {
+                    cmdBuffer.CmdBindDescriptorSets(descriptorSets, gfxPipeline.get(), {modelDataOffset});
+                };
+
+                if (batch.IsInstancing && batch.IsUsedIndices)
+                {
+                    // groups were rebuilt before recording
+                    for (auto& group : cachedBatch->InstanceGroups)
                     {
-                        // bind descriptor sets
+                        visibleInstances.clear();
+                        for (const auto instance : group.Instances)
                         {
-                            array_list<gfx::GFXDescriptorSet*> descriptorSets;
-                            // setup 0. per cam
-                            for (auto& refData : targetFBO->RefData)
-                            {
-                                descriptorSets.push_back(refData.lock().get());
-                            }
-                            // setup 1. world
-                            descriptorSets.push_back(world->GetWorldDescriptorSet().get());
-                            // setup 2. light data
-                            descriptorSets.push_back(world->GetLightManager()->GetDescriptorSet().get());
-                            // setup 3. per renderer
-                            descriptorSets.push_back(element.ModelDescriptor.get());
-                            // setup 4. per material
-                            const auto materialDesc = batch.Material->GetGfxDescriptorSet().get();
-
-                            if(materialDesc->GetDescriptorCount() != 0)
+                            if (instance->IsVisibleInView(viewId))
                             {
-                                descriptorSets.push_back(materialDesc);
+                                visibleInstances.push_back(instance);
                             }
-                            cmdBuffer.CmdBindDescriptorSets(descriptorSets, gfxPipeline.get());
                         }
-
-                        // bind vertex
-                        cmdBuffer.CmdBindVertexBuffers({element.Vertex.get()});
-                        if (batch.IsUsedIndices)
+                        if (visibleInstances.empty())
                         {
-                            cmdBuffer.CmdBindIndexBuffer(element.Indices.get());
+                            continue;
                         }
+                        bindPipeline();
+                        cmdBuffer.CmdBindVertexBuffers({group.Vertex.get()});
+                        cmdBuffer.CmdBindIndexBuffer(group.Indices.get());
 
-                        // draw
-                        if (batch.IsUsedIndices)
-                        {
-                            cmdBuffer.CmdDrawIndexed(element.Indices->GetElementCount());
-                        }
-                        else
+                        // the descriptor range limits how many instances one draw can read
+                        for (size_t first = 0; first < visibleInstances.size(); first += maxInstancesPerDraw)
                         {
-                            cmdBuffer.CmdDraw(element.Vertex->GetElementCount());
+                            const auto count = std::min(maxInstancesPerDraw, visibleInstances.size() - first);
+                            auto allocation = dynamicBuffer->Allocate(count * sizeof(CBuffer_ModelObject));
+                            auto instanceData = static_cast<CBuffer_ModelObject*>(allocation.Data);
+                            for (size_t i = 0; i < count; ++i)
+                            {
+                                instanceData[i] = visibleInstances[first + i]->GetPerModelData();
+                            }
+
+                            bindDescriptorSets(allocation.Offset);
+                            cmdBuffer.CmdDrawIndexed(group.Indices->GetElementCount(), static_cast<uint32_t>(count));
                         }
                     }
+                    continue;
+                }
 
-                } // end batches
-
-                cmdBuffer.CmdEndFrameBuffer();
-                cmdBuffer.SetFrameBuffer(nullptr);
-
-                // post processing
-                RCPtr<RenderTexture> lastPPRt;
-                auto ppcount = cam->GetPostProcessCount();
-                size_t ppCount = 0;
-                for (size_t i = 0; i < ppcount; ++i)
+                for (auto& element : batch.Elements)
                 {
-                    auto ppMat = cam->GetPostprocess(i);
-                    if (!ppMat)
+                    if (!element.Owner->IsVisibleInView(viewId))
                     {
                         continue;
                     }
-                    RCPtr<RenderTexture> srcRt;
-                    RCPtr<RenderTexture> destRt;
-                    gfx::GFXDescriptorSet_sp srcResourceDescSet;
-                    if(i % 2 == 1)
+
+                    bindPipeline();
+                    bindDescriptorSets(dynamicBuffer->Push(element.Owner->GetPerModelData()));
+
+                    // bind vertex
+                    cmdBuffer.CmdBindVertexBuffers({element.Vertex.get()});
+                    if (batch.IsUsedIndices)
                     {
-                        srcResourceDescSet = cam->m_postprocessDescA;
-                        srcRt = cam->m_postprocessRtB;
-                        destRt = cam->m_postprocessRtA;
+                        cmdBuffer.CmdBindIndexBuffer(element.Indices.get());
                     }
-                    else //first
+
+                    // draw
+                    if (batch.IsUsedIndices)
                     {
-                        srcResourceDescSet = cam->m_postprocessDescB;
-                        srcRt = cam->m_postprocessRtA;
-                        destRt = cam->m_postprocessRtB;
+                        cmdBuffer.CmdDrawIndexed(element.Indices->GetElementCount());
                     }
-                    lastPPRt = destRt;
-
-                    if (i == 0)
+                    else
                     {
-                        cmdBuffer.CmdBlit(cam->GetRenderTexture()->GetGfxRenderTarget0().get(), srcRt->GetGfxRenderTarget0().get());
+                        cmdBuffer.CmdDraw(element.Vertex->GetElementCount());
                     }
-                    cmdBuffer.CmdImageTransitionBarrier(srcRt->GetGfxRenderTarget0().get(), gfx::GFXResourceLayout::ShaderReadOnly);
-                    cmdBuffer.CmdImageTransitionBarrier(destRt->GetGfxRenderTarget0().get(), gfx::GFXResourceLayout::RenderTarget);
+                }
 
-                    cmdBuffer.SetFrameBuffer(destRt->GetGfxFrameBufferObject().get());
-                    cmdBuffer.CmdBeginFrameBuffer();
-                    cmdBuffer.CmdSetViewport(0, 0, (float)targetFBO->GetWidth(), (float)targetFBO->GetHeight());
+            } // end batches
 
-                    array_list<gfx::GFXDescriptorSetLayout_sp> descriptorSetLayouts;
-                    for (auto& refData : targetFBO->RefData)
-                    {
-                        descriptorSetLayouts.push_back(refData.lock()->GetDescriptorSetLayout());
-                    }
-                    descriptorSetLayouts.push_back(world->GetWorldDescriptorSet()->GetDescriptorSetLayout());
+            cmdBuffer.CmdEndFrameBuffer();
+            cmdBuffer.SetFrameBuffer(nullptr);
 
-                    struct InitPPDescLayout
-                    {
-                        InitPPDescLayout()
-                        {
-                            gfx::GFXDescriptorSetLayoutInfo info[2] {
-                                {
-                                    gfx::GFXDescriptorType::CombinedImageSampler,
-                                    gfx::GFXShaderStageFlags::VertexFragment,
-                                    0, 2
-                                },
-                                {
-                                    gfx::GFXDescriptorType::CombinedImageSampler,
-                                    gfx::GFXShaderStageFlags::VertexFragment,
-                                    1, 2
-                                }
-                            };
-                            layout = Application::GetGfxApp()->CreateDescriptorSetLayout(info, 2);
-                        }
-                        gfx::GFXDescriptorSetLayout_sp layout;
-                    } _InitPPDescLayout{};
+            // post processing
+            RCPtr<RenderTexture> lastPPRt;
+            auto ppcount = cam->GetPostProcessCount();
+            size_t ppCount = 0;
+            for (size_t i = 0; i < ppcount; ++i)
+            {
+                auto ppMat = cam->GetPostprocess(i);
+                if (!ppMat)
+                {
+                    continue;
+                }
+                RCPtr<RenderTexture> srcRt;
+                RCPtr<RenderTexture> destRt;
+                gfx::GFXDescriptorSet_sp srcResourceDescSet;
+                if(i % 2 == 1)
+                {
+                    srcResourceDescSet = cam->m_postprocessDescA;
+                    srcRt = cam->m_postprocessRtB;
+                    destRt = cam->m_postprocessRtA;
+                }
+                else //first
+                {
+                    srcResourceDescSet = cam->m_postprocessDescB;
+                    srcRt = cam->m_postprocessRtA;
+                    destRt = cam->m_postprocessRtB;
+                }
+                lastPPRt = destRt;
 
-                    descriptorSetLayouts.push_back(_InitPPDescLayout.layout);
-                    descriptorSetLayouts.push_back(ppMat->GetGfxDescriptorSetLayout());
+                if (i == 0)
+                {
+                    cmdBuffer.CmdBlit(cam->GetRenderTexture()->GetGfxRenderTarget0().get(), srcRt->GetGfxRenderTarget0().get());
+                }
+                cmdBuffer.CmdImageTransitionBarrier(srcRt->GetGfxRenderTarget0().get(), gfx::GFXResourceLayout::ShaderReadOnly);
+                cmdBuffer.CmdImageTransitionBarrier(destRt->GetGfxRenderTarget0().get(), gfx::GFXResourceLayout::RenderTarget);
 
-                    auto pso = pipelineMgr->GetGraphicsPipeline(
-                        ppMat->GetGfxShaderPass(),
-                        descriptorSetLayouts,
-                        destRt->GetGfxFrameBufferObject()->GetRenderPassLayout(), {});
+                cmdBuffer.SetFrameBuffer(destRt->GetGfxFrameBufferObject().get());
+                cmdBuffer.CmdBeginFrameBuffer();
+                cmdBuffer.CmdSetViewport(0, 0, (float)targetFBO->GetWidth(), (float)targetFBO->GetHeight());
 
-                    cmdBuffer.CmdBindGraphicsPipeline(pso.get());
+                array_list<gfx::GFXDescriptorSetLayout_sp> descriptorSetLayouts;
+                for (auto& refData : targetFBO->RefData)
+                {
+                    descriptorSetLayouts.push_back(refData.lock()->GetDescriptorSetLayout());
+                }
+                descriptorSetLayouts.push_back(world->GetWorldDescriptorSet()->GetDescriptorSetLayout());
+                descriptorSetLayouts.push_back(frame.PostProcessDescLayout);
+                descriptorSetLayouts.push_back(ppMat->GetGfxDescriptorSetLayout());
+
+                auto pso = pipelineMgr->GetGraphicsPipeline(
+                    ppMat->GetGfxShaderPass(),
+                    descriptorSetLayouts,
+                    destRt->GetGfxFrameBufferObject()->GetRenderPassLayout(), {});
 
+                cmdBuffer.CmdBindGraphicsPipeline(pso.get());
+
+                {
+                    array_list<gfx::GFXDescriptorSet*> descriptorSets;
+                    // setup cam
+                    for (auto& refData : targetFBO->RefData)
                     {
-                        array_list<gfx::GFXDescriptorSet*> descriptorSets;
-                        // setup cam
-                        for (auto& refData : targetFBO->RefData)
-                        {
-                            descriptorSets.push_back(refData.lock().get());
-                        }
-                        // setup world
-                        descriptorSets.push_back(world->GetWorldDescriptorSet().get());
-                        // setup model
-                        descriptorSets.push_back(srcResourceDescSet.get());
-                        // setup matinst
-                        const auto materialDesc = ppMat->GetGfxDescriptorSet().get();
-                        if(materialDesc->GetDescriptorCount() != 0)
-                        {
-                            descriptorSets.push_back(materialDesc);
-                        }
-                        cmdBuffer.CmdBindDescriptorSets(descriptorSets, pso.get());
+                        descriptorSets.push_back(refData.lock().get());
+                    }
+                    // setup world
+                    descriptorSets.push_back(world->GetWorldDescriptorSet().get());
+                    // setup model
+                    descriptorSets.push_back(srcResourceDescSet.get());
+                    // setup matinst
+                    const auto materialDesc = ppMat->GetGfxDescriptorSet().get();
+                    if(materialDesc->GetDescriptorCount() != 0)
+                    {
+                        descriptorSets.push_back(materialDesc);
                     }
+                    cmdBuffer.CmdBindDescriptorSets(descriptorSets, pso.get());
+                }
+
+                cmdBuffer.CmdDraw(3);
+
+                cmdBuffer.CmdEndFrameBuffer();
+                cmdBuffer.SetFrameBuffer(nullptr);
+
+                ++ppCount;
+            } // end for pp
+            if (ppCount)
+            {
+                //blit to target
+                cmdBuffer.CmdBlit(lastPPRt->GetGfxRenderTarget0().get(), cam->GetRenderTexture()->GetGfxRenderTarget0().get());
+            }
 
-                    cmdBuffer.CmdDraw(3);
+            cam->SetRenderStats(cmdBuffer.GetStats());
+            cmdBuffer.End();
+        }
+    }
 
-                    cmdBuffer.CmdEndFrameBuffer();
-                    cmdBuffer.SetFrameBuffer(nullptr);
+    void EngineRenderPipeline::OnRender(
+        gfx::GFXRenderContext* context, gfx::GFXFrameBufferObject* backbuffer)
+    {
+        auto gfxApp = context->GetApplication();
 
-                    ++ppCount;
-                } // end for pp
-                if (ppCount)
+        if (!m_postProcessDescLayout)
+        {
+            gfx::GFXDescriptorSetLayoutInfo info[2] {
+                {
+                    gfx::GFXDescriptorType::CombinedImageSampler,
+                    gfx::GFXShaderStageFlags::VertexFragment,
+                    0, 2
+                },
                 {
-                    //blit to target
-                    cmdBuffer.CmdBlit(lastPPRt->GetGfxRenderTarget0().get(), cam->GetRenderTexture()->GetGfxRenderTarget0().get());
+                    gfx::GFXDescriptorType::CombinedImageSampler,
+                    gfx::GFXShaderStageFlags::VertexFragment,
+                    1, 2
                 }
+            };
+            m_postProcessDescLayout = gfxApp->CreateDescriptorSetLayout(info, 2);
+        }
+
+        array_list<CameraRenderJob> jobs;
+        // every element drawn by every camera at one allocation each is the most the frame can use
+        size_t maxModelAllocations = 0;
+        for (auto world : m_worlds)
+        {
+            // picks up transforms moved after the world tick
+            world->GetTransformManager().Update();
+
+            auto& batchCache = world->GetMeshBatchCache();
+            size_t elementCount = 0;
+            for (const auto cachedBatch : batchCache.GetBatches())
+            {
+                batchCache.UpdateElements(cachedBatch);
+                elementCount += cachedBatch->Batch.Elements.size();
+            }
+            maxModelAllocations += elementCount * world->GetCameraManager().GetCameras().size();
+
+            for (const auto& cam : world->GetCameraManager().GetCameras())
+            {
+                CameraRenderJob job{
+                    world,
+                    cam.GetPtr(),
+                    rendering::ViewCulling{
+                        cam->GetViewProjectionMat(),
+                        cam->GetNode()->GetTransform()->GetWorldPosition(),
+                        cam->GetMaxDrawDistance()},
+                    0,
+                    context->GetCommandBufferCount()};
+                context->AddCommandBuffer();
+                jobs.push_back(job);
             }
         }
 
+        // lazily created and cached state is touched here, before the cameras are recorded in parallel
+        FrameRenderData frame{};
+        frame.PipelineManager = gfxApp->GetGraphicsPipelineManager();
+        frame.DynamicBuffer = gfxApp->GetDynamicBuffer();
+        // grows the ring before any allocation, the model descriptor set follows its buffer
+        frame.DynamicBuffer->Reserve(maxModelAllocations, sizeof(CBuffer_ModelObject));
+        frame.ModelDescriptorSet = rendering::RenderObject::GetModelDescriptorSet();
+        frame.MaxInstancesPerDraw = rendering::RenderObject::GetMaxModelCountPerDraw();
+        frame.PostProcessDescLayout = m_postProcessDescLayout;
+
+        // cameras recorded at the same time need distinct visibility slots
+        auto jobSystem = Application::GetJobSystem();
+        constexpr size_t waveSize = rendering::RenderObject::kMaxConcurrentViews;
+        for (size_t waveBegin = 0; waveBegin < jobs.size(); waveBegin += waveSize)
+        {
+            const auto waveCount = std::min(waveSize, jobs.size() - waveBegin);
+            for (size_t i = 0; i < waveCount; ++i)
+            {
+                jobs[waveBegin + i].ViewId = ++m_cullingViewId;
+            }
+
+            jobSystem->ParallelFor(waveCount, [&](size_t index) {
+                const auto& job = jobs[waveBegin + index];
+                RecordCamera(context->GetCommandBuffer(job.CommandBufferIndex), job, frame);
+            });
+        }
     }
     void EngineRenderPipeline::AddWorld(World* world)
     {
@@ -297,6 +434,12 @@ namespace pulsar
         cfg->WindowHeight = 720;
         strcpy(cfg->Title, "Pulsar v0.1 - vulkan 1.3");
         strcpy(cfg->ProgramName, "Pulsar");
+        StringUtil::strcpy(cfg->PipelineCachePath, (AppRootDir() / "pipelinecache.bin").string());
+        if (m_isHeadless)
+        {
+            cfg->Api = gfx::GFXApi::Null;
+            cfg->HeadlessFrameCount = m_headlessFrameCount;
+        }
     }
 
     void EngineAppInstance::OnInitialized()
@@ -307,14 +450,22 @@ namespace pulsar
         // SystemInterface::SetQuitCallBack(_quitting);
         // RenderInterface::SetViewport(0, 0, (int)size.x, (int)size.y);
 
+        m_assetManager = std::make_unique<CookedAssetManager>();
+        m_assetManager->MountFolder(AppRootDir() / "Cooked");
+
         World::Reset<World>("MainWorld");
         Application::GetGfxApp()->SetRenderPipeline(new EngineRenderPipeline{World::Current()});
     }
 
     void EngineAppInstance::OnTerminate()
     {
+        if (m_isHeadless && m_checkHeadlessStats)
+        {
+            CheckHeadlessStats();
+        }
 
         World::Reset(nullptr);
+        m_assetManager.reset();
     }
 
     void EngineAppInstance::OnBeginRender(float dt)
@@ -322,6 +473,8 @@ namespace pulsar
         auto bgc = Color4f{0.2f, 0.2f, 0.2f, 0.2};
         // RenderInterface::Clear(bgc.r, bgc.g, bgc.b, bgc.a);
 
+        // finish async loads before the world sees them
+        m_assetManager->Tick();
         World::Current()->Tick(dt);
 
         static int a = 0;
@@ -335,6 +488,63 @@ namespace pulsar
     }
     void EngineAppInstance::OnEndRender(float d4)
     {
+        RuntimeObjectManager::TickGCollect();
+
+        if (m_isHeadless && m_checkHeadlessStats && !m_headlessHalfStats)
+        {
+            const auto stats = static_cast<gfx::GFXNullApplication*>(Application::GetGfxApp())->GetStatistics();
+            if (stats.FrameCount >= m_headlessFrameCount / 2)
+            {
+                m_headlessHalfStats = stats;
+            }
+        }
+    }
+
+    void EngineAppInstance::CheckHeadlessStats()
+    {
+        auto fail = [this](std::string_view reason) {
+            Logger::Log(std::format("headless stats check failed: {}", reason), LogLevel::Error);
+            m_headlessStatsPassed = false;
+        };
+
+        const auto last = static_cast<gfx::GFXNullApplication*>(Application::GetGfxApp())->GetStatistics();
+        if (m_headlessFrameCount < 2 || !m_headlessHalfStats || last.FrameCount != m_headlessFrameCount)
+        {
+            fail(std::format("{} of {} frames ran, the check needs at least 2", last.FrameCount, m_headlessFrameCount));
+            return;
+        }
+
+        // the first half warms up caches and pools, nothing may be created after it
+        const auto& half = *m_headlessHalfStats;
+        if (last.PipelineCreateCount != half.PipelineCreateCount)
+        {
+            fail(std::format("{} pipelines created after warm up", last.PipelineCreateCount - half.PipelineCreateCount));
+        }
+        if (last.DescriptorSetAllocationCount != half.DescriptorSetAllocationCount)
+        {
+            fail(std::format("{} descriptor sets allocated after warm up", last.DescriptorSetAllocationCount - half.DescriptorSetAllocationCount));
+        }
+        if (last.BufferAllocationCount != half.BufferAllocationCount)
+        {
+            fail(std::format("{} buffers allocated after warm up", last.BufferAllocationCount - half.BufferAllocationCount));
+        }
+        if (last.TextureAllocationCount != half.TextureAllocationCount)
+        {
+            fail(std::format("{} textures allocated after warm up", last.TextureAllocationCount - half.TextureAllocationCount));
+        }
+
+        // the scene does not change, so the binds per frame must not grow either
+        auto binds = [](const gfx::GFXNullStatistics& stats) {
+            return stats.PipelineBindCount + stats.DescriptorSetBindCount + stats.VertexBufferBindCount + stats.IndexBufferBindCount;
+        };
+        const auto halfFrames = half.FrameCount;
+        const auto lastFrames = last.FrameCount - half.FrameCount;
+        const auto halfBinds = binds(half);
+        const auto lastBinds = binds(last) - halfBinds;
+        if (lastBinds * halfFrames > halfBinds * lastFrames)
+        {
+            fail(std::format("{} binds in the last {} frames, {} in the first {}", lastBinds, lastFrames, halfBinds, halfFrames));
+        }
     }
 
     bool EngineAppInstance::IsQuit()
@@ -372,7 +582,7 @@ namespace pulsar
 
     AssetManager* EngineAppInstance::GetAssetManager()
     {
-        return nullptr;
+        return m_assetManager.get();
     }
 
     rendering::Pipeline* EngineAppInstance::GetPipeline()
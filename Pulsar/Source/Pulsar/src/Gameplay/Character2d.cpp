@@ -8,6 +8,12 @@
 
 namespace pulsar
 {
+    Character2d::Character2d()
+    {
+        m_canTick = true;
+        m_tickReads = TickAccess::Input | TickAccess::Transform;
+        m_tickWrites = TickAccess::Transform;
+    }
 
     void Character2d::BeginPlay()
     {
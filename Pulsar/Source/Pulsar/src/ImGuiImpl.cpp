@@ -219,6 +219,7 @@ namespace pulsar
             {
                 auto vkCmd = dynamic_cast<gfx::GFXVulkanCommandBuffer*>(cmd);
                 ImGui_ImplVulkan_RenderDrawData(draw_data, vkCmd->GetVkCommandBuffer());
+                vkCmd->ResetBindState();
             }
         }
 
@@ -3,6 +3,12 @@
 
 namespace pulsar
 {
+    InputComponent::InputComponent()
+    {
+        m_canTick = true;
+        m_tickReads = TickAccess::Input;
+        m_tickWrites = TickAccess::None;
+    }
 
     void InputComponent::Bind(string_view name, SPtr<InputEventDelegate> callback)
     {
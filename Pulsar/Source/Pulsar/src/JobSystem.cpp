@@ -0,0 +1,127 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+namespace pulsar
+{
+    uint32_t JobSystem::GetDefaultWorkerCount()
+    {
+        // leave the main thread its own core
+        const auto hardwareCount = std::thread::hardware_concurrency();
+        return hardwareCount > 1 ? hardwareCount - 1 : 1;
+    }
+
+    JobSystem::JobSystem(uint32_t workerCount)
+    {
+        m_workers.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; ++i)
+        {
+            m_workers.emplace_back(&JobSystem::WorkerMain, this);
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard lock{m_mutex};
+            m_isStopping = true;
+        }
+        m_condition.notify_all();
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    void JobSystem::Schedule(std::function<void()> job, JobCounter* counter)
+    {
+        if (counter)
+        {
+            counter->m_pending.fetch_add(1, std::memory_order_relaxed);
+        }
+        {
+            std::lock_guard lock{m_mutex};
+            m_jobs.push_back({std::move(job), counter});
+        }
+        m_condition.notify_one();
+    }
+
+    void JobSystem::RunJob(Job& job)
+    {
+        job.Func();
+        if (job.Counter)
+        {
+            job.Counter->m_pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+    bool JobSystem::TryRunOne()
+    {
+        Job job;
+        {
+            std::lock_guard lock{m_mutex};
+            if (m_jobs.empty())
+            {
+                return false;
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+        RunJob(job);
+        return true;
+    }
+
+    void JobSystem::Wait(JobCounter& counter)
+    {
+        while (!counter.IsDone())
+        {
+            if (!TryRunOne())
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::ParallelFor(size_t count, const std::function<void(size_t index)>& func)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        std::atomic<size_t> nextIndex{0};
+        auto runIndices = [&] {
+            for (size_t i = nextIndex.fetch_add(1); i < count; i = nextIndex.fetch_add(1))
+            {
+                func(i);
+            }
+        };
+
+        JobCounter counter;
+        const auto helperCount = std::min<size_t>(count - 1, m_workers.size());
+        for (size_t i = 0; i < helperCount; ++i)
+        {
+            Schedule(runIndices, &counter);
+        }
+        runIndices();
+        Wait(counter);
+    }
+
+    void JobSystem::WorkerMain()
+    {
+        while (true)
+        {
+            Job job;
+            {
+                std::unique_lock lock{m_mutex};
+                m_condition.wait(lock, [this] { return m_isStopping || !m_jobs.empty(); });
+                if (m_jobs.empty())
+                {
+                    return;
+                }
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+            RunJob(job);
+        }
+    }
+}
@@ -32,6 +32,10 @@ namespace pulsar
     }
     bool Node::GetIsActive() const
     {
+        if (m_runtimeScene)
+        {
+            return m_activeInHierarchy;
+        }
         Node_ref node = this->GetObjectHandle();
         while (node)
         {
@@ -57,18 +61,7 @@ namespace pulsar
             return;
         }
         m_active = value;
-
-        for (auto child : *GetTransform()->GetChildren())
-        {
-            if (child->GetNode()->GetIsActiveSelf())
-            {
-                child->GetNode()->OnParentActiveChanged();
-            }
-        }
-        if (value)
-            OnActive();
-        else
-            OnInactive();
+        OnParentActiveChanged();
     }
     ObjectPtr<Node> Node::GetParent() const
     {
@@ -102,16 +95,30 @@ namespace pulsar
 
     void Node::OnParentActiveChanged()
     {
-        if (m_runtimeScene)
+        if (!m_runtimeScene)
         {
-            if (GetIsActive())
-            {
-                OnActive();
-            }
-            else
-            {
-                OnInactive();
-            }
+            return;
+        }
+        const auto parent = GetParent();
+        const bool isActive = m_active && (!parent || parent->GetIsActive());
+        if (isActive == m_activeInHierarchy)
+        {
+            return;
+        }
+        m_activeInHierarchy = isActive;
+
+        // parents begin before and end after their children
+        if (isActive)
+        {
+            OnActive();
+        }
+        for (auto& child : *GetTransform()->GetChildren())
+        {
+            child->GetNode()->OnParentActiveChanged();
+        }
+        if (!isActive)
+        {
+            OnInactive();
         }
     }
 
@@ -159,8 +166,11 @@ namespace pulsar
 
     void Node::BeginNode(ObjectPtr<Scene> scene)
     {
+        // the parent may not have begun yet, so the chain is walked once here
+        const bool isActive = GetIsActive();
         m_runtimeScene = scene;
-        if (GetIsActive())
+        m_activeInHierarchy = isActive;
+        if (isActive)
         {
             OnActive();
         }
@@ -168,10 +178,11 @@ namespace pulsar
 
     void Node::EndNode()
     {
-        if (GetIsActive())
+        if (m_activeInHierarchy)
         {
             OnInactive();
         }
+        m_activeInHierarchy = false;
         m_runtimeScene = nullptr;
     }
     void Node::BeginPlay()
@@ -206,6 +217,7 @@ namespace pulsar
         // init
         component->m_ownerNode = self_ref();
         component->m_ownerNodePtr = this;
+        component->m_componentTypeInfo = ComponentTypeRegistry::GetInfo(type);
 
         bool isTransform = type->IsSubclassOf(cltypeof<TransformComponent>());
         if (!m_components->empty() && isTransform)
@@ -222,7 +234,7 @@ namespace pulsar
             m_transform = sptr_cast<TransformComponent>(component).get();
         }
 
-        if (m_runtimeScene && m_runtimeScene->GetWorld())
+        if (m_activeInHierarchy && m_runtimeScene->GetWorld())
         {
             BeginComponent(component);
             component->OnTransformChanged();
@@ -242,7 +254,7 @@ namespace pulsar
         {
             return;
         }
-        if (m_runtimeScene)
+        if (m_activeInHierarchy)
         {
             if (GetRuntimeWorld()->GetPlaying())
             {
@@ -267,10 +279,15 @@ namespace pulsar
     }
 
     ObjectPtr<Component> Node::GetComponent(Type* type) const
+    {
+        return GetComponent(type, ComponentTypeRegistry::GetInfo(type));
+    }
+
+    ObjectPtr<Component> Node::GetComponent(Type* type, const ComponentTypeInfo* info) const
     {
         for (auto& item : *this->m_components)
         {
-            if (type->IsInstanceOfType(item.GetPtr()))
+            if (IsComponentOf(item.GetPtr(), type, info))
             {
                 return item;
             }
@@ -304,7 +321,7 @@ namespace pulsar
     {
         for (auto& comp : *this->m_components)
         {
-            if (comp)
+            if (comp && comp->CanTick())
             {
                 comp->OnTick(ticker);
             }
@@ -313,6 +330,10 @@ namespace pulsar
     void Node::BeginComponent(Component_ref component)
     {
         component->BeginComponent();
+        if (component->CanTick())
+        {
+            GetRuntimeWorld()->GetTickManager().AddComponent(component.GetPtr());
+        }
     }
 
     void Node::EndComponent(Component_ref component)
@@ -320,6 +341,10 @@ namespace pulsar
         if (component)
         {
             component->EndComponent();
+            if (component->m_tickIndex != Component::kInvalidTickIndex)
+            {
+                GetRuntimeWorld()->GetTickManager().RemoveComponent(component.GetPtr());
+            }
         }
     }
 
@@ -1,100 +1,216 @@
 #include <CoreLib/Guid.h>
 #include <Pulsar/ObjectBase.h>
+#include <atomic>
+#include <chrono>
 #include <map>
+#include <mutex>
 #include <ranges>
+#include <shared_mutex>
 
 namespace pulsar
 {
 
     namespace
     {
-        struct RuntimeObjectPointerValue
+        // generation in the high word and a count in the low word, changed together
+        // so a stale handle never counts on a recycled slot
+        struct SlotCounter
         {
-            ObjectHandle Handle{};
+            std::atomic<uint64_t> State{};
+
+            uint32_t LoadGeneration(std::memory_order order) const
+            {
+                return uint32_t(State.load(order) >> 32);
+            }
+            int LoadCount() const
+            {
+                return int(uint32_t(State.load()));
+            }
+            // false when the slot was recycled
+            bool Add(uint32_t generation)
+            {
+                auto state = State.load(std::memory_order_relaxed);
+                do
+                {
+                    if (uint32_t(state >> 32) != generation)
+                    {
+                        return false;
+                    }
+                } while (!State.compare_exchange_weak(state, state + 1, std::memory_order_relaxed));
+                return true;
+            }
+            // the remaining count, -1 when the slot was recycled
+            int Release(uint32_t generation)
+            {
+                auto state = State.load(std::memory_order_relaxed);
+                do
+                {
+                    if (uint32_t(state >> 32) != generation || uint32_t(state) == 0)
+                    {
+                        return -1;
+                    }
+                } while (!State.compare_exchange_weak(state, state - 1));
+                return int(uint32_t(state) - 1);
+            }
+        };
+
+        struct ObjectSlot
+        {
+            // read lock free through runtime handles
+            std::atomic<ObjectBase*> Pointer{};
+            // references of RCPtr, the object is destroyed when the last one goes
+            SlotCounter Refs;
+            // references of ObjectPtr, they only keep the guid on the slot
+            SlotCounter WeakRefs;
+            // the guid as words, readers check the generation around them
+            std::atomic<uint64_t> HandleWords[2]{};
+            // no object and not persistent, recycled once nothing references the slot
+            std::atomic<bool> IsDead{};
+
+            // guarded by the shard of the guid
             SPtr<ObjectBase> OriginalObject;
-            [[not_null]] SPtr<ManagedPointer> ManagedPtr;
 
-            [[always_inline]] bool IsValid() const
+            uint32_t LoadGeneration(std::memory_order order = std::memory_order_acquire) const
+            {
+                return Refs.LoadGeneration(order);
+            }
+            bool IsReferenced() const
+            {
+                return Refs.LoadCount() != 0 || WeakRefs.LoadCount() != 0;
+            }
+            // bumps the generation and drops the counts of the old one
+            void Recycle()
             {
-                return OriginalObject != nullptr;
+                const auto next = uint64_t(LoadGeneration(std::memory_order_relaxed) + 1) << 32;
+                WeakRefs.State.store(next, std::memory_order_relaxed);
+                Refs.State.store(next, std::memory_order_release);
             }
 
-            void Destroy()
+            ObjectHandle LoadHandle() const
+            {
+                const auto a = HandleWords[0].load(std::memory_order_relaxed);
+                const auto b = HandleWords[1].load(std::memory_order_relaxed);
+                return ObjectHandle{uint32_t(a >> 32), uint32_t(a), uint32_t(b >> 32), uint32_t(b)};
+            }
+            void StoreHandle(const ObjectHandle& handle)
             {
-                Handle = {};
-                OriginalObject.reset();
-                ManagedPtr->SetEmptyPtr();
+                HandleWords[0].store(uint64_t(handle.x) << 32 | handle.y, std::memory_order_relaxed);
+                HandleWords[1].store(uint64_t(handle.z) << 32 | handle.w, std::memory_order_relaxed);
             }
         };
 
+        struct ObjectShard
+        {
+            std::shared_mutex Mutex;
+            hash_map<ObjectHandle, uint32_t> Map;
+        };
+
+        // pages are never moved or freed, so a slot address stays valid while other threads grow the table
+        constexpr uint32_t kSlotPageBits = 10;
+        constexpr uint32_t kSlotPageSize = 1 << kSlotPageBits;
+        constexpr uint32_t kMaxSlotPages = 4096;
+        constexpr uint32_t kShardCount = 16;
+
         struct ObjectManager
         {
-            array_list<RuntimeObjectPointerValue> Array;
-            hash_map<ObjectHandle, size_t> Map;
+            std::atomic<ObjectSlot*> Pages[kMaxSlotPages]{};
+            std::atomic<uint32_t> SlotCount{};
 
-            RuntimeObjectPointerValue& Emplace(const ObjectHandle& handle)
-            {
-                auto& value = Array.emplace_back();
-                value.Handle = handle;
-                Map.emplace(handle, Array.size() - 1);
-                return value;
-            }
+            std::mutex SlotMutex;
+            array_list<uint32_t> FreeSlots;
+            array_list<uint32_t> DeadSlots;
 
-            static constexpr size_t npos = std::numeric_limits<size_t>::max();
+            ObjectShard Shards[kShardCount];
 
-            size_t Find(const ObjectHandle& handle) const
+            ObjectShard& GetShard(const ObjectHandle& handle)
             {
-                auto it = Map.find(handle);
-                if (it != Map.end())
-                    return it->second;
-                return npos;
+                return Shards[std::hash<ObjectHandle>()(handle) % kShardCount];
             }
 
-            RuntimeObjectPointerValue& At(size_t index)
+            [[always_inline]] ObjectSlot& At(uint32_t index)
             {
-                return Array[index];
+                return Pages[index >> kSlotPageBits].load(std::memory_order_acquire)[index & (kSlotPageSize - 1)];
             }
 
-            RuntimeObjectPointerValue* Get(const ObjectHandle& handle)
+            RuntimeObjectHandle GetRuntimeHandle(uint32_t index)
             {
-                auto index = Find(handle);
-                if (index == npos) return nullptr;
-                return &At(index);
+                return {index, At(index).LoadGeneration(std::memory_order_relaxed)};
             }
 
-            void Remove(const ObjectHandle& handle)
+            uint32_t AllocSlot(const ObjectHandle& handle)
             {
-                auto it = Map.find(handle);
-                if (it == Map.end())
-                    return;
-
-                auto index = it->second;
-
-                auto lastHandle = Array[Array.size() - 1].Handle;
+                uint32_t index;
+                {
+                    std::lock_guard lock{SlotMutex};
+                    if (!FreeSlots.empty())
+                    {
+                        index = FreeSlots.back();
+                        FreeSlots.pop_back();
+                    }
+                    else
+                    {
+                        index = SlotCount.load(std::memory_order_relaxed);
+                        const auto page = index >> kSlotPageBits;
+                        if (page >= kMaxSlotPages)
+                        {
+                            // nothing was registered yet, the caller still owns its object
+                            throw EngineException("runtime object table is full");
+                        }
+                        if (!Pages[page].load(std::memory_order_relaxed))
+                        {
+                            Pages[page].store(new ObjectSlot[kSlotPageSize], std::memory_order_release);
+                        }
+                        SlotCount.store(index + 1, std::memory_order_release);
+                    }
+                }
+                // the generation was bumped when the slot was freed, readers of stale handles see it before the new guid
+                std::atomic_thread_fence(std::memory_order_release);
+                At(index).StoreHandle(handle);
+                return index;
+            }
 
-                Array[index] = Array[Array.size() - 1];
-                Map[lastHandle] = index;
+            // the shard of the slot guid must be locked exclusively
+            void FreeSlot(ObjectShard& shard, uint32_t index)
+            {
+                auto& slot = At(index);
+                shard.Map.erase(slot.LoadHandle());
+                slot.IsDead.store(false, std::memory_order_relaxed);
+                slot.Pointer.store(nullptr, std::memory_order_relaxed);
+                slot.Recycle();
+
+                std::lock_guard lock{SlotMutex};
+                FreeSlots.push_back(index);
+            }
 
-                Map.erase(handle);
-                Array.pop_back();
+            // the shard must be locked exclusively
+            uint32_t FindOrAdd(ObjectShard& shard, const ObjectHandle& handle)
+            {
+                if (auto it = shard.Map.find(handle); it != shard.Map.end())
+                {
+                    return it->second;
+                }
+                const auto index = AllocSlot(handle);
+                // only reserved until an object is created, freed like a destroyed one when unreferenced
+                At(index).IsDead.store(true);
+                shard.Map.emplace(handle, index);
+                return index;
             }
 
-            void Clear()
+            // after a count of the slot dropped to zero
+            void OnReleased(uint32_t index)
             {
-                decltype(Array){}.swap(Array);
-                decltype(Map){}.swap(Map);
+                auto& slot = At(index);
+                if (slot.IsReferenced() || !slot.IsDead.load())
+                {
+                    return;
+                }
+                // may be queued twice with DestroyObject, the collector checks the slot state
+                std::lock_guard lock{SlotMutex};
+                DeadSlots.push_back(index);
             }
         };
     }
 
-
-    // using _object_table_t = hash_map<ObjectHandle, RuntimeObjectPointerValue>;
-    // static auto& _object_table()
-    // {
-    //     static _object_table_t table;
-    //     return table;
-    // }
-
     static ObjectManager& GetObjectManager()
     {
         static ObjectManager Mgr;
@@ -113,194 +229,439 @@ namespace pulsar
     {
         if (id.is_empty())
             return nullptr;
-        if (auto ptr = GetObjectManager().Get(id))
+        auto& mgr = GetObjectManager();
+        auto& shard = mgr.GetShard(id);
+        std::shared_lock lock{shard.Mutex};
+        if (auto it = shard.Map.find(id); it != shard.Map.end())
         {
-            return ptr->OriginalObject.get();
+            return mgr.At(it->second).Pointer.load(std::memory_order_acquire);
         }
         return nullptr;
     }
 
-    SPtr<ObjectBase> RuntimeObjectManager::GetSharedObject(const ObjectHandle& id) noexcept
+    ObjectBase* RuntimeObjectManager::GetObject(RuntimeObjectHandle handle) noexcept
     {
-        if (id.is_empty())
-            return nullptr;
-        if (auto ptr = GetObjectManager().Get(id))
+        auto& slot = GetObjectManager().At(handle.Index);
+        // pointers are published after the generation, a matching generation read afterwards
+        // means the pointer still belongs to the handle
+        const auto ptr = slot.Pointer.load(std::memory_order_acquire);
+        if (slot.LoadGeneration() == handle.Generation)
         {
-            return ptr->OriginalObject;
+            return ptr;
         }
         return nullptr;
     }
-    SPtr<ManagedPointer> RuntimeObjectManager::GetPointer(const ObjectHandle& id) noexcept
+
+    ObjectHandle RuntimeObjectManager::GetObjectHandle(RuntimeObjectHandle handle) noexcept
+    {
+        auto& slot = GetObjectManager().At(handle.Index);
+        if (slot.LoadGeneration() != handle.Generation)
+        {
+            return {};
+        }
+        const auto id = slot.LoadHandle();
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.LoadGeneration(std::memory_order_relaxed) != handle.Generation)
+        {
+            return {};
+        }
+        return id;
+    }
+
+    SPtr<ObjectBase> RuntimeObjectManager::GetSharedObject(const ObjectHandle& id) noexcept
     {
-        if (auto ptr = GetObjectManager().Get(id))
+        if (id.is_empty())
+            return nullptr;
+        auto& mgr = GetObjectManager();
+        auto& shard = mgr.GetShard(id);
+        std::shared_lock lock{shard.Mutex};
+        if (auto it = shard.Map.find(id); it != shard.Map.end())
         {
-            return ptr->ManagedPtr;
+            return mgr.At(it->second).OriginalObject;
         }
         return nullptr;
     }
 
-    SPtr<ManagedPointer> RuntimeObjectManager::AddWaitPointer(const ObjectHandle& id)
+    static SlotCounter& _GetCounter(ObjectSlot& slot, ObjectRefKind ref)
     {
-        auto& ptr = GetObjectManager().Emplace(id);
-        ptr.ManagedPtr = mksptr(new ManagedPointer{});
-        return ptr.ManagedPtr;
+        return ref == ObjectRefKind::Strong ? slot.Refs : slot.WeakRefs;
     }
 
-    bool RuntimeObjectManager::IsValid(const ObjectHandle& id) noexcept
+    RuntimeObjectHandle RuntimeObjectManager::GetRuntimeHandle(const ObjectHandle& id, ObjectRefKind ref)
     {
-        if (id.is_empty())
-            return false;
-        if (auto ptr = GetObjectManager().Get(id))
+        // counted under the lock, the collector recycles only unreferenced slots while holding it
+        auto& mgr = GetObjectManager();
+        auto& shard = mgr.GetShard(id);
         {
-            return ptr->ManagedPtr->Pointer != nullptr;
+            std::shared_lock lock{shard.Mutex};
+            if (auto it = shard.Map.find(id); it != shard.Map.end())
+            {
+                const auto handle = mgr.GetRuntimeHandle(it->second);
+                _GetCounter(mgr.At(it->second), ref).Add(handle.Generation);
+                return handle;
+            }
         }
-        return false;
+        std::unique_lock lock{shard.Mutex};
+        const auto index = mgr.FindOrAdd(shard, id);
+        const auto handle = mgr.GetRuntimeHandle(index);
+        _GetCounter(mgr.At(index), ref).Add(handle.Generation);
+        return handle;
     }
 
-    void RuntimeObjectManager::NewInstance(SPtr<ObjectBase>&& managedObj, const ObjectHandle& handle) noexcept
+    void RuntimeObjectManager::AddRef(RuntimeObjectHandle handle) noexcept
     {
-        const auto id = handle.is_empty() ? _NewId() : handle;
-        managedObj->m_objectHandle = id;
+        GetObjectManager().At(handle.Index).Refs.Add(handle.Generation);
+    }
 
-        if (auto ptr = GetObjectManager().Get(id))
+    int RuntimeObjectManager::ReleaseRef(RuntimeObjectHandle handle) noexcept
+    {
+        auto& mgr = GetObjectManager();
+        const auto count = mgr.At(handle.Index).Refs.Release(handle.Generation);
+        if (count == 0)
         {
-            ptr->OriginalObject = std::move(managedObj);
-            ptr->ManagedPtr->Pointer = ptr->OriginalObject.get();
+            mgr.OnReleased(handle.Index);
         }
-        else
+        return count;
+    }
+
+    bool RuntimeObjectManager::AddWeakRef(RuntimeObjectHandle handle) noexcept
+    {
+        return GetObjectManager().At(handle.Index).WeakRefs.Add(handle.Generation);
+    }
+
+    void RuntimeObjectManager::ReleaseWeakRef(RuntimeObjectHandle handle) noexcept
+    {
+        auto& mgr = GetObjectManager();
+        if (mgr.At(handle.Index).WeakRefs.Release(handle.Generation) == 0)
         {
-            auto& newPtr = GetObjectManager().Emplace(id);
-            newPtr.OriginalObject = std::move(managedObj);;
-            newPtr.ManagedPtr = mksptr(new ManagedPointer{});
-            newPtr.ManagedPtr->Pointer = newPtr.OriginalObject.get();
+            mgr.OnReleased(handle.Index);
         }
+    }
 
+    bool RuntimeObjectManager::IsValid(const ObjectHandle& id) noexcept
+    {
+        return GetObject(id) != nullptr;
+    }
+
+    void RuntimeObjectManager::NewInstance(SPtr<ObjectBase>&& managedObj, const ObjectHandle& handle)
+    {
+        const auto id = handle.is_empty() ? _NewId() : handle;
+
+        auto& mgr = GetObjectManager();
+        auto& shard = mgr.GetShard(id);
+        std::unique_lock lock{shard.Mutex};
+        // throws before the object is touched when the table is full
+        const auto index = mgr.FindOrAdd(shard, id);
+        auto& slot = mgr.At(index);
+        managedObj->m_objectHandle = id;
+        managedObj->m_runtimeHandle = mgr.GetRuntimeHandle(index);
+        // a destroyed object of the same guid that was not collected yet keeps its slot
+        slot.IsDead.store(false, std::memory_order_relaxed);
+        slot.OriginalObject = std::move(managedObj);
+        slot.Pointer.store(slot.OriginalObject.get(), std::memory_order_release);
     }
 
     bool RuntimeObjectManager::DestroyObject(const ObjectHandle& id, bool isForce) noexcept
     {
         if (id.is_empty())
             return false;
-        auto ptr = GetObjectManager().Get(id);
-        if (ptr == nullptr) return true;
 
-        if (const auto obj = ptr->OriginalObject.get())
+        auto& mgr = GetObjectManager();
+        auto& shard = mgr.GetShard(id);
+        SPtr<ObjectBase> obj;
+        uint32_t index;
         {
-            const bool dontDestory = obj->HasObjectFlags(OF_LifecycleManaged);
-            if (!dontDestory || (dontDestory && isForce))
-            {
-                obj->Destroy();
-                ptr->OriginalObject.reset();
-                ptr->ManagedPtr->SetEmptyPtr();
-                if (ptr->ManagedPtr.use_count() == 1)
-                {
-                    ptr->ManagedPtr.reset();
-                    GetObjectManager().Remove(id);
-                }
-
+            std::shared_lock lock{shard.Mutex};
+            auto it = shard.Map.find(id);
+            if (it == shard.Map.end())
                 return true;
-            }
+            index = it->second;
+            obj = mgr.At(index).OriginalObject;
         }
-        else
+        // a reserved guid, pointers keep it until the object is created
+        if (!obj)
+            return true;
+
+        const bool dontDestory = obj->HasObjectFlags(OF_LifecycleManaged);
+        if (dontDestory && !isForce)
+        {
+            return false;
+        }
+        // outside of the lock, destroying may destroy other objects
+        const bool isPersistent = obj->HasObjectFlags(OF_Persistent);
+        obj->Destroy();
+
+        std::unique_lock lock{shard.Mutex};
+        auto& slot = mgr.At(index);
+        if (slot.OriginalObject != obj || slot.LoadHandle() != id)
         {
-            if (ptr->ManagedPtr.use_count() == 1)
-            {
-                ptr->ManagedPtr.reset();
-                GetObjectManager().Remove(id);
-            }
             return true;
         }
+        slot.Pointer.store(nullptr, std::memory_order_release);
+        slot.OriginalObject.reset();
+        // persistent objects keep the slot, a reload of the guid reconnects existing pointers.
+        // other slots are recycled once no pointer references them
+        if (!isPersistent && !slot.IsDead.exchange(true))
+        {
+            std::lock_guard slotLock{mgr.SlotMutex};
+            mgr.DeadSlots.push_back(index);
+        }
+        lock.unlock();
+        // the last reference may run destructors that destroy other objects
+        obj.reset();
+        return true;
+    }
 
-        return false;
+    bool RuntimeObjectManager::DestroyObject(RuntimeObjectHandle handle, bool isForce) noexcept
+    {
+        const auto id = GetObjectHandle(handle);
+        if (id.is_empty())
+            return true;
+        return DestroyObject(id, isForce);
     }
 
     void RuntimeObjectManager::GetData(size_t* total, size_t* place, size_t* alive)
     {
         size_t p = 0, a = 0;
-        for (auto& item : GetObjectManager().Array)
-        {
-            if (item.OriginalObject)
+        ForEachObject([&](const RuntimeObjectInfo& info) {
+            if (info.Pointer)
             {
                 ++a;
             }
             else
             {
-                if (item.ManagedPtr)
-                {
-                    ++p;
-                }
+                ++p;
             }
-        }
-        *total = GetObjectManager().Array.size();
+        });
+        *total = p + a;
         *place = p;
         *alive = a;
     }
     void RuntimeObjectManager::Terminate()
     {
+        auto& mgr = GetObjectManager();
         array_list<ObjectHandle> destroyList;
-        for (const auto& item : GetObjectManager().Array)
+        ForEachObject([&](const RuntimeObjectInfo& info) {
+            if (info.Pointer && !info.Pointer->HasObjectFlags(OF_LifecycleManaged))
+            {
+                destroyList.push_back(info.Handle);
+            }
+        });
+        for (auto& id : destroyList)
+        {
+            DestroyObject(id);
+        }
+
+        // release the rest, the pages stay for pointers that are released later
+        array_list<SPtr<ObjectBase>> releaseList;
+        for (auto& shard : mgr.Shards)
         {
-            if (item.IsValid())
+            std::unique_lock lock{shard.Mutex};
+            while (!shard.Map.empty())
             {
-                if (item.OriginalObject->HasObjectFlags(OF_LifecycleManaged))
+                const auto index = shard.Map.begin()->second;
+                auto& slot = mgr.At(index);
+                if (slot.OriginalObject)
                 {
-                    continue;
+                    releaseList.push_back(std::move(slot.OriginalObject));
                 }
-                destroyList.push_back(item.Handle);
+                mgr.FreeSlot(shard, index);
             }
+            decltype(shard.Map){}.swap(shard.Map);
         }
-        for (auto& id : destroyList)
         {
-            DestroyObject(id);
+            std::lock_guard lock{mgr.SlotMutex};
+            mgr.DeadSlots.clear();
         }
-
-        // release memory
-        GetObjectManager().Clear();
+        releaseList.clear();
     }
 
-    void RuntimeObjectManager::TickGCollect()
+    namespace
     {
-        constexpr size_t kProcessPerFrame = 2;
+        using GCollectClock = std::chrono::steady_clock;
+        // items handled between two clock reads
+        constexpr size_t kBudgetCheckInterval = 16;
+
+        constexpr auto kNoDeadline = GCollectClock::time_point::max();
+
+        bool IsOverDeadline(size_t processed, GCollectClock::time_point deadline)
+        {
+            // at least one item per pass, so a tiny budget still makes progress
+            return deadline != kNoDeadline && processed != 0 && processed % kBudgetCheckInterval == 0 && GCollectClock::now() >= deadline;
+        }
 
-        static ObjectHandle list[kProcessPerFrame];
-        size_t listCount = 0;
+        int64_t GetMicroseconds(GCollectClock::time_point start)
+        {
+            return std::chrono::duration_cast<std::chrono::microseconds>(GCollectClock::now() - start).count();
+        }
+    }
 
-        static size_t itIndex = -1;
-        if (GetObjectManager().Array.empty())
+    void DeferredDestroyQueue::Push(const ObjectPtrBase& object, bool isForce)
+    {
+        const auto ptr = object.GetObjectPointer();
+        if (!ptr)
         {
             return;
         }
+        std::lock_guard lock{m_mutex};
+        m_entries.push_back({ptr->GetType(), object.RuntimeHandle, isForce});
+    }
+
+    size_t DeferredDestroyQueue::Process(GCollectClock::time_point deadline)
+    {
+        const auto start = GCollectClock::now();
 
-        for (size_t i = 0; i < kProcessPerFrame; ++i)
+        size_t processed = 0;
+        for (;;)
         {
-            ++itIndex;
-            if (itIndex >= GetObjectManager().Array.size())
+            if (m_cursor == m_batch.size())
             {
-                itIndex = 0;
+                m_batch.clear();
+                m_cursor = 0;
+                {
+                    std::lock_guard lock{m_mutex};
+                    m_batch.swap(m_entries);
+                }
+                if (m_batch.empty())
+                {
+                    break;
+                }
+                std::ranges::stable_sort(m_batch, {}, &Entry::ObjectType);
             }
-            auto& it = GetObjectManager().At(itIndex);
-            if (!it.IsValid() && it.ManagedPtr.use_count() == 1)
+            if (IsOverDeadline(processed, deadline))
             {
-                list[listCount] = it.Handle;
-                listCount++;
+                break;
             }
+            // outside of the lock, destroying may push more objects
+            const auto& entry = m_batch[m_cursor++];
+            RuntimeObjectManager::DestroyObject(entry.Handle, entry.IsForce);
+            ++processed;
         }
+        m_batchRemaining.store(m_batch.size() - m_cursor, std::memory_order_relaxed);
+
+        m_stats.Backlog = GetCount();
+        m_stats.Processed = processed;
+        m_stats.TimeMicroseconds = GetMicroseconds(start);
+        return processed;
+    }
 
-        for (auto i = 0; i < listCount; ++i)
+    size_t DeferredDestroyQueue::GetCount() const
+    {
+        std::lock_guard lock{m_mutex};
+        return m_entries.size() + m_batchRemaining.load(std::memory_order_relaxed);
+    }
+
+    static DeferredDestroyQueue& GetDestroyQueue()
+    {
+        static DeferredDestroyQueue queue;
+        return queue;
+    }
+    static std::atomic<uint32_t> _GCollectBudget{1000};
+    // written by the collecting thread only
+    static GCollectStats _GCollectStats;
+
+    static void _CollectGarbage(bool isDrain)
+    {
+        const auto start = GCollectClock::now();
+
+        auto& queue = GetDestroyQueue();
+        size_t processed = queue.Process(isDrain ? kNoDeadline : RuntimeObjectManager::MakeGCollectDeadline());
+
+        // recycles the slots of destroyed objects, only the guid map and the slots are touched.
+        // a budget of its own, destroying fills the list and would otherwise leave no time to empty it
+        const auto deadline = isDrain ? kNoDeadline : RuntimeObjectManager::MakeGCollectDeadline();
+        auto& mgr = GetObjectManager();
+        array_list<uint32_t> deadSlots;
+        {
+            std::lock_guard lock{mgr.SlotMutex};
+            deadSlots.swap(mgr.DeadSlots);
+        }
+        size_t i = 0;
+        for (; i < deadSlots.size() && !IsOverDeadline(i, deadline); ++i)
         {
-            GetObjectManager().Remove(list[i]);
+            const auto index = deadSlots[i];
+            auto& slot = mgr.At(index);
+            const auto handle = slot.LoadHandle();
+            auto& shard = mgr.GetShard(handle);
+            std::unique_lock lock{shard.Mutex};
+            // a referenced slot keeps its guid, the last release queues it again
+            if (slot.IsDead.load() && !slot.OriginalObject && slot.LoadHandle() == handle && !slot.IsReferenced())
+            {
+                mgr.FreeSlot(shard, index);
+            }
+        }
+        processed += i;
+
+        size_t deadCount;
+        {
+            std::lock_guard lock{mgr.SlotMutex};
+            mgr.DeadSlots.insert(mgr.DeadSlots.end(), deadSlots.begin() + i, deadSlots.end());
+            deadCount = mgr.DeadSlots.size();
         }
 
+        _GCollectStats.Backlog = queue.GetCount() + deadCount;
+        _GCollectStats.Processed = processed;
+        _GCollectStats.TimeMicroseconds = GetMicroseconds(start);
+    }
+
+    void RuntimeObjectManager::TickGCollect()
+    {
+        _CollectGarbage(false);
+    }
+
+    void RuntimeObjectManager::DrainGCollect()
+    {
+        _CollectGarbage(true);
+    }
+
+    GCollectClock::time_point RuntimeObjectManager::MakeGCollectDeadline()
+    {
+        const auto budget = _GCollectBudget.load(std::memory_order_relaxed);
+        return budget == 0 ? kNoDeadline : GCollectClock::now() + std::chrono::microseconds(budget);
+    }
+
+    void RuntimeObjectManager::SetGCollectBudget(uint32_t microseconds)
+    {
+        _GCollectBudget.store(microseconds, std::memory_order_relaxed);
+    }
+
+    uint32_t RuntimeObjectManager::GetGCollectBudget()
+    {
+        return _GCollectBudget.load(std::memory_order_relaxed);
+    }
+
+    GCollectStats RuntimeObjectManager::GetGCollectStats()
+    {
+        return _GCollectStats;
+    }
+
+    void RuntimeObjectManager::DeferDestroyObject(RuntimeObjectHandle handle, bool isForce)
+    {
+        GetDestroyQueue().Push(ObjectPtrBase{handle}, isForce);
     }
 
     void RuntimeObjectManager::ForEachObject(const std::function<void(const RuntimeObjectInfo&)>& func)
     {
-        for (auto& item : GetObjectManager().Array)
+        // collected first, func may call back into the manager
+        auto& mgr = GetObjectManager();
+        array_list<RuntimeObjectInfo> infos;
+        for (auto& shard : mgr.Shards)
+        {
+            std::shared_lock lock{shard.Mutex};
+            for (const auto& [handle, index] : shard.Map)
+            {
+                auto& slot = mgr.At(index);
+                RuntimeObjectInfo info;
+                info.Handle = handle;
+                info.Pointer = slot.OriginalObject.get();
+                info.RefCount = slot.Refs.LoadCount();
+                info.WeakRefCount = slot.WeakRefs.LoadCount();
+                info.Generation = slot.LoadGeneration(std::memory_order_relaxed);
+                infos.push_back(info);
+            }
+        }
+        for (const auto& info : infos)
         {
-            RuntimeObjectInfo info;
-            info.Handle = item.Handle;
-            info.Pointer = item.OriginalObject.get();
-            info.ManagedCounter = item.ManagedPtr.use_count();
             func(info);
         }
     }
@@ -310,13 +671,20 @@ namespace pulsar
         static hash_map<ObjectHandle, array_list<ObjectHandle>> map;
         return map;
     }
+    static std::mutex& _dependsMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
 
     void RuntimeObjectManager::AddDependList(ObjectHandle src, ObjectHandle dest)
     {
+        std::lock_guard lock{_dependsMutex()};
         _depends()[dest].emplace_back(src);
     }
     void RuntimeObjectManager::RemoveDependList(ObjectHandle src, ObjectHandle dest)
     {
+        std::lock_guard lock{_dependsMutex()};
         std::erase(_depends()[dest], src);
         if (_depends()[dest].empty())
         {
@@ -325,18 +693,24 @@ namespace pulsar
     }
     void RuntimeObjectManager::NotifyDependObjects(ObjectHandle dest, DependencyObjectState id)
     {
-        auto it = _depends().find(dest);
-        if (it != _depends().end())
+        // copied, receivers may change the lists
+        array_list<ObjectHandle> srcIds;
         {
-            for (const auto& srcId : it->second)
+            std::lock_guard lock{_dependsMutex()};
+            auto it = _depends().find(dest);
+            if (it == _depends().end())
             {
-                if (auto src = ObjectPtr<ObjectBase>(srcId).GetPtr())
-                {
-                    src->OnDependencyMessage(dest, id);
-                }
+                return;
+            }
+            srcIds = it->second;
+        }
+        for (const auto& srcId : srcIds)
+        {
+            if (auto src = RuntimeObjectManager::GetObject(srcId))
+            {
+                src->OnDependencyMessage(dest, id);
             }
         }
-
     }
 
     ObjectBase::ObjectBase()
@@ -384,6 +758,7 @@ namespace pulsar
     {
         this->OnDestroy();
         this->m_objectHandle = ObjectHandle{};
+        this->m_runtimeHandle = RuntimeObjectHandle{};
     }
 
     void ObjectBase::OnDestroy()
@@ -397,7 +772,7 @@ namespace pulsar
 
     std::iostream& ReadWriteStream(std::iostream& stream, bool isWrite, ObjectPtrBase& obj)
     {
-        ObjectHandle handle = obj.Handle;
+        ObjectHandle handle = obj.GetHandle();
 
         sser::ReadWriteStream(stream, isWrite, handle.x);
         sser::ReadWriteStream(stream, isWrite, handle.y);
@@ -413,7 +788,7 @@ namespace pulsar
     }
     std::iostream& ReadWriteStream(std::iostream& stream, bool isWrite, RCPtrBase& obj)
     {
-        ObjectHandle handle = obj.Handle;
+        ObjectHandle handle = obj.GetHandle();
 
         sser::ReadWriteStream(stream, isWrite, handle.x);
         sser::ReadWriteStream(stream, isWrite, handle.y);
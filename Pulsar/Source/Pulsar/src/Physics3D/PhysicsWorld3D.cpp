@@ -1,4 +1,6 @@
 #include "Physics3D/PhysicsWorld3D.h"
+#include "Application.h"
+#include "JobSystem.h"
 
 #include <Jolt/Jolt.h>
 #include <Jolt/Physics/Body/BodyActivationListener.h>
@@ -11,9 +13,13 @@
 #include <Jolt/RegisterTypes.h>
 
 #include <Jolt/Core/Factory.h>
-#include <Jolt/Core/JobSystemThreadPool.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
 #include <Jolt/Core/TempAllocator.h>
 
+#include <chrono>
+#include <thread>
+
 namespace pulsar
 {
     using namespace JPH;
@@ -154,6 +160,78 @@ namespace pulsar
         }
     };
 
+    // runs jolt jobs on the engine job system instead of a second thread pool
+    class JoltJobSystem final : public JobSystemWithBarrier
+    {
+    public:
+        JoltJobSystem(pulsar::JobSystem* jobSystem, uint maxJobs, uint maxBarriers)
+            : JobSystemWithBarrier(maxBarriers), m_jobSystem(jobSystem)
+        {
+            m_jobs.Init(maxJobs, maxJobs);
+        }
+        ~JoltJobSystem() override
+        {
+            // queued wrappers still release their job into the free list
+            if (m_jobSystem)
+                m_jobSystem->Wait(m_pending);
+        }
+
+        int GetMaxConcurrency() const override
+        {
+            return m_jobSystem ? int(m_jobSystem->GetWorkerCount()) + 1 : 1;
+        }
+
+        JobHandle CreateJob(const char* inName, ColorArg inColor, const JobFunction& inJobFunction, uint32 inNumDependencies = 0) override
+        {
+            uint32 index;
+            for (;;)
+            {
+                index = m_jobs.ConstructObject(inName, inColor, this, inJobFunction, inNumDependencies);
+                if (index != AvailableJobs::cInvalidObjectIndex)
+                    break;
+                JPH_ASSERT(false, "No jobs available!");
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+            Job* job = &m_jobs.Get(index);
+            JobHandle handle(job);
+            if (inNumDependencies == 0)
+                QueueJob(job);
+            return handle;
+        }
+
+    protected:
+        void QueueJob(Job* inJob) override
+        {
+            // without workers the barrier runs the job when it is waited on
+            if (!m_jobSystem || m_jobSystem->GetWorkerCount() == 0)
+                return;
+
+            // execute is a no-op when the barrier already took the job
+            inJob->AddRef();
+            m_jobSystem->Schedule([inJob] {
+                inJob->Execute();
+                inJob->Release();
+            }, &m_pending);
+        }
+
+        void QueueJobs(Job** inJobs, uint inNumJobs) override
+        {
+            for (uint i = 0; i < inNumJobs; ++i)
+                QueueJob(inJobs[i]);
+        }
+
+        void FreeJob(Job* inJob) override
+        {
+            m_jobs.DestructObject(inJob);
+        }
+
+    private:
+        using AvailableJobs = FixedSizeFreeList<Job>;
+        AvailableJobs m_jobs;
+        pulsar::JobSystem* m_jobSystem;
+        JobCounter m_pending;
+    };
+
     class _PhysicsWorld3DNative
     {
     public:
@@ -171,7 +249,7 @@ namespace pulsar
         ObjectLayerPairFilterImpl object_vs_object_layer_filter;
 
         TempAllocatorImpl temp_allocator{10 * 1024 * 1024};
-        JobSystemThreadPool job_system{cMaxPhysicsJobs, cMaxPhysicsBarriers, int(std::thread::hardware_concurrency() - 1)};
+        JoltJobSystem job_system{Application::GetJobSystem(), cMaxPhysicsJobs, cMaxPhysicsBarriers};
         MyBodyActivationListener body_activation_listener;
         MyContactListener contact_listener;
 
@@ -6,8 +6,6 @@
 
 namespace pulsar
 {
-    static inline gfx::GFXDescriptorSetLayout_wp MeshDescriptorSetLayout{};
-
     void LineRenderObject::SetPoints(const array_list<Vector3f>& pointPairs, const array_list<Color4f>& pointColors)
     {
         m_verties.clear();
@@ -34,6 +32,11 @@ namespace pulsar
             if (sizeof(StaticMeshVertex) * m_verties.size() > m_vertBuffer->GetSize())
             {
                 m_vertBuffer = Application::GetGfxApp()->CreateBuffer(gfx::GFXBufferUsage::Vertex, m_verties.size() * sizeof(StaticMeshVertex));
+                if (!m_batchs.empty())
+                {
+                    m_batchs[0].Elements[0].Vertex = m_vertBuffer;
+                    SubmitBatchsChanged();
+                }
             }
             m_vertBuffer->SetElementCount(m_verties.size());
             m_vertBuffer->Fill(m_verties.data());
@@ -43,24 +46,8 @@ namespace pulsar
     void LineRenderObject::OnCreateResource()
     {
         base::OnCreateResource();
-        if (MeshDescriptorSetLayout.expired())
-        {
-            gfx::GFXDescriptorSetLayoutInfo info{
-                gfx::GFXDescriptorType::ConstantBuffer,
-                gfx::GFXShaderStageFlags::VertexFragment,
-                0, kRenderingDescriptorSpace_ModelInfo};
-            m_meshDescriptorSetLayout = Application::GetGfxApp()->CreateDescriptorSetLayout(&info, 1);
-            MeshDescriptorSetLayout = m_meshDescriptorSetLayout;
-        }
-        else
-        {
-            m_meshDescriptorSetLayout = MeshDescriptorSetLayout.lock();
-        }
-
-        m_meshConstantBuffer = Application::GetGfxApp()->CreateBuffer(gfx::GFXBufferUsage::ConstantBuffer, sizeof(CBuffer_ModelObject));
-        m_meshObjDescriptorSet = Application::GetGfxApp()->GetDescriptorManager()->GetDescriptorSet(m_meshDescriptorSetLayout);
-        m_meshObjDescriptorSet->AddDescriptor("ModelObject", 0)->SetConstantBuffer(m_meshConstantBuffer.get());
-        m_meshObjDescriptorSet->Submit();
+        m_meshDescriptorSetLayout = GetModelDescriptorSetLayout();
+        m_meshObjDescriptorSet = GetModelDescriptorSet();
 
         m_vertBuffer = Application::GetGfxApp()->CreateBuffer(gfx::GFXBufferUsage::Vertex, m_verties.size() * sizeof(StaticMeshVertex));
         m_vertBuffer->SetElementCount(m_verties.size());
@@ -85,11 +72,6 @@ namespace pulsar
         m_vertBuffer.reset();
     }
 
-    void LineRenderObject::OnChangedTransform()
-    {
-        m_meshConstantBuffer->Fill(&m_perModelData);
-    }
-
     array_list<rendering::MeshBatch> LineRenderObject::GetMeshBatchs()
     {
         for (const auto& batch : m_batchs)
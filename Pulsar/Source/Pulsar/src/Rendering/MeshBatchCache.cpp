@@ -0,0 +1,207 @@
+#include "Rendering/MeshBatchCache.h"
+
+namespace pulsar::rendering
+{
+    MeshBatchCache::~MeshBatchCache()
+    {
+        Clear();
+    }
+
+    void MeshBatchCache::Add(RenderObject* renderObject)
+    {
+        if (m_objectStates.contains(renderObject))
+        {
+            Update(renderObject);
+            return;
+        }
+        renderObject->m_batchCache = this;
+
+        auto& states = m_objectStates[renderObject];
+        for (auto& batch : renderObject->GetMeshBatchs())
+        {
+            const auto state = batch.GetRenderState();
+
+            auto& cached = m_batches[state];
+            if (!cached)
+            {
+                cached = std::make_unique<CachedMeshBatch>();
+                cached->RenderState = state;
+                cached->Batch = batch;
+                cached->Batch.Elements.clear();
+                m_isDirtySorting = true;
+            }
+
+            auto& indices = cached->OwnerElements[renderObject];
+            for (auto& element : batch.Elements)
+            {
+                indices.push_back(cached->Batch.Elements.size());
+                auto& cachedElement = cached->Batch.Elements.emplace_back(element);
+                cachedElement.Owner = renderObject;
+            }
+            cached->IsDirtyElements = true;
+
+            if (std::ranges::find(states, state) == states.end())
+            {
+                states.push_back(state);
+            }
+        }
+    }
+
+    void MeshBatchCache::Remove(RenderObject* renderObject)
+    {
+        if (!m_objectStates.contains(renderObject))
+        {
+            return;
+        }
+        RemoveElements(renderObject);
+        m_objectStates.erase(renderObject);
+        renderObject->m_batchCache = nullptr;
+    }
+
+    void MeshBatchCache::Update(RenderObject* renderObject)
+    {
+        Remove(renderObject);
+        Add(renderObject);
+    }
+
+    void MeshBatchCache::Clear()
+    {
+        for (auto& renderObject : m_objectStates | std::views::keys)
+        {
+            renderObject->m_batchCache = nullptr;
+        }
+        m_objectStates.clear();
+        m_batches.clear();
+        m_sortedBatches.clear();
+        m_isDirtySorting = false;
+    }
+
+    void MeshBatchCache::RemoveElements(RenderObject* renderObject)
+    {
+        for (auto state : m_objectStates[renderObject])
+        {
+            auto it = m_batches.find(state);
+            if (it == m_batches.end())
+            {
+                continue;
+            }
+            auto& cached = *it->second;
+            auto& elements = cached.Batch.Elements;
+            auto ownerIt = cached.OwnerElements.find(renderObject);
+            if (ownerIt != cached.OwnerElements.end())
+            {
+                auto indices = std::move(ownerIt->second);
+                cached.OwnerElements.erase(ownerIt);
+                // from the back, so the last element is never one of the owner still to be removed
+                std::ranges::sort(indices, std::greater<>{});
+                for (const auto index : indices)
+                {
+                    const auto last = elements.size() - 1;
+                    if (index != last)
+                    {
+                        elements[index] = std::move(elements[last]);
+                        auto& moved = cached.OwnerElements[elements[index].Owner];
+                        *std::ranges::find(moved, last) = index;
+                    }
+                    elements.pop_back();
+                }
+            }
+            if (elements.empty())
+            {
+                m_batches.erase(it);
+                m_isDirtySorting = true;
+            }
+            else
+            {
+                it->second->IsDirtyElements = true;
+            }
+        }
+    }
+
+    void MeshBatchCache::UpdateElements(CachedMeshBatch* cached)
+    {
+        if (!cached->IsDirtyElements)
+        {
+            return;
+        }
+        cached->IsDirtyElements = false;
+
+        // neighbouring draws of the same mesh can keep their vertex and index bindings
+        std::ranges::sort(cached->Batch.Elements, [](const MeshBatchElement& a, const MeshBatchElement& b) {
+            if (a.Vertex != b.Vertex)
+            {
+                return std::less<>{}(a.Vertex.get(), b.Vertex.get());
+            }
+            if (a.Indices != b.Indices)
+            {
+                return std::less<>{}(a.Indices.get(), b.Indices.get());
+            }
+            return std::less<>{}(a.Owner, b.Owner);
+        });
+
+        for (auto& indices : cached->OwnerElements | std::views::values)
+        {
+            indices.clear();
+        }
+        for (size_t i = 0; i < cached->Batch.Elements.size(); ++i)
+        {
+            cached->OwnerElements[cached->Batch.Elements[i].Owner].push_back(i);
+        }
+
+        if (!cached->Batch.IsInstancing)
+        {
+            return;
+        }
+        cached->InstanceGroups.clear();
+
+        // elements are sorted, a group is a run of the same vertex buffer
+        for (auto& element : cached->Batch.Elements)
+        {
+            if (cached->InstanceGroups.empty() || cached->InstanceGroups.back().Vertex != element.Vertex)
+            {
+                auto& group = cached->InstanceGroups.emplace_back();
+                group.Vertex = element.Vertex;
+                group.Indices = element.Indices;
+            }
+            cached->InstanceGroups.back().Instances.push_back(element.Owner);
+        }
+    }
+
+    const array_list<CachedMeshBatch*>& MeshBatchCache::GetBatches()
+    {
+        if (m_isDirtySorting)
+        {
+            m_isDirtySorting = false;
+            m_sortedBatches.clear();
+            m_sortedBatches.reserve(m_batches.size());
+            for (auto& batch : m_batches | std::views::values)
+            {
+                m_sortedBatches.push_back(batch.get());
+            }
+
+            // pipeline, then material, so binds can be skipped between neighbouring batches
+            std::ranges::sort(m_sortedBatches, [](const CachedMeshBatch* a, const CachedMeshBatch* b) {
+                const auto shaderA = a->Batch.Material ? a->Batch.Material->GetShader().GetPtr() : nullptr;
+                const auto shaderB = b->Batch.Material ? b->Batch.Material->GetShader().GetPtr() : nullptr;
+                if (shaderA != shaderB)
+                {
+                    return std::less<>{}(shaderA, shaderB);
+                }
+                const auto stateA = a->Batch.State.GetHashCode();
+                const auto stateB = b->Batch.State.GetHashCode();
+                if (stateA != stateB)
+                {
+                    return stateA < stateB;
+                }
+                const auto materialA = a->Batch.Material.GetPtr();
+                const auto materialB = b->Batch.Material.GetPtr();
+                if (materialA != materialB)
+                {
+                    return std::less<>{}(materialA, materialB);
+                }
+                return a->RenderState < b->RenderState;
+            });
+        }
+        return m_sortedBatches;
+    }
+} // namespace pulsar::rendering
@@ -1,4 +1,6 @@
 #include "Rendering/RenderObject.h"
+#include "Rendering/MeshBatchCache.h"
+#include "Application.h"
 
 namespace pulsar::rendering
 {
@@ -16,4 +18,53 @@ namespace pulsar::rendering
 
         OnChangedTransform();
     }
+
+    static gfx::GFXDescriptorSetLayout_wp ModelDescriptorSetLayout;
+    static gfx::GFXDescriptorSet_wp ModelDescriptorSet;
+    // the dynamic buffer replaces its buffer when it grows
+    static gfx::GFXBuffer* ModelDescriptorSetBuffer;
+
+    gfx::GFXDescriptorSetLayout_sp RenderObject::GetModelDescriptorSetLayout()
+    {
+        if (auto layout = ModelDescriptorSetLayout.lock())
+        {
+            return layout;
+        }
+        gfx::GFXDescriptorSetLayoutInfo info{
+            gfx::GFXDescriptorType::DynamicStructuredBuffer,
+            gfx::GFXShaderStageFlags::VertexFragment,
+            0, kRenderingDescriptorSpace_ModelInfo};
+        auto layout = Application::GetGfxApp()->CreateDescriptorSetLayout(&info, 1);
+        ModelDescriptorSetLayout = layout;
+        return layout;
+    }
+
+    gfx::GFXDescriptorSet_sp RenderObject::GetModelDescriptorSet()
+    {
+        auto dynamicBuffer = Application::GetGfxApp()->GetDynamicBuffer();
+        if (auto descriptorSet = ModelDescriptorSet.lock(); descriptorSet && ModelDescriptorSetBuffer == dynamicBuffer->GetBuffer())
+        {
+            return descriptorSet;
+        }
+        auto descriptorSet = Application::GetGfxApp()->GetDescriptorManager()->GetDescriptorSet(GetModelDescriptorSetLayout());
+        descriptorSet->AddDescriptor("ModelObject", 0)->SetDynamicStructuredBuffer(
+            dynamicBuffer->GetBuffer(), GetMaxModelCountPerDraw() * sizeof(CBuffer_ModelObject));
+        descriptorSet->Submit();
+        ModelDescriptorSet = descriptorSet;
+        ModelDescriptorSetBuffer = dynamicBuffer->GetBuffer();
+        return descriptorSet;
+    }
+
+    size_t RenderObject::GetMaxModelCountPerDraw()
+    {
+        return Application::GetGfxApp()->GetDynamicBuffer()->GetMaxBindingRange() / sizeof(CBuffer_ModelObject);
+    }
+
+    void RenderObject::SubmitBatchsChanged()
+    {
+        if (m_batchCache)
+        {
+            m_batchCache->Update(this);
+        }
+    }
 } // namespace pulsar
\ No newline at end of file
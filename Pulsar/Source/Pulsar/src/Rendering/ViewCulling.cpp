@@ -0,0 +1,54 @@
+#include "Rendering/ViewCulling.h"
+
+namespace pulsar::rendering
+{
+    ViewCulling::ViewCulling(const Matrix4f& viewProjection, const Vector3f& viewPosition, float maxDrawDistance)
+        : m_frustum(Frustum3f::CreateFromMatrix_ZO(viewProjection)),
+          m_viewPosition(viewPosition),
+          m_maxDrawDistance(maxDrawDistance)
+    {
+    }
+
+    bool ViewCulling::IsVisible(const RenderObject* renderObject, ViewCullingStats* stats) const
+    {
+        if (!renderObject->HasBounds())
+        {
+            if (stats) ++stats->VisibleCount;
+            return true;
+        }
+        const auto& bounds = renderObject->GetBoundsWS();
+
+        if (m_maxDrawDistance > 0.f)
+        {
+            const auto distance = jmath::Distance(m_viewPosition, bounds.Origin) - bounds.Radius;
+            if (distance > m_maxDrawDistance)
+            {
+                if (stats) ++stats->DistanceCulledCount;
+                return false;
+            }
+        }
+
+        if (!m_frustum.IsOverlapped(bounds))
+        {
+            if (stats) ++stats->FrustumCulledCount;
+            return false;
+        }
+
+        if (stats) ++stats->VisibleCount;
+        return true;
+    }
+
+    void ViewCulling::Cull(
+        const hash_set<RenderObject_sp>& renderObjects,
+        uint32_t viewId,
+        ViewCullingStats* stats) const
+    {
+        for (const auto& renderObject : renderObjects)
+        {
+            if (IsVisible(renderObject.get(), stats))
+            {
+                renderObject->MarkVisible(viewId);
+            }
+        }
+    }
+} // namespace pulsar::rendering
@@ -56,16 +56,6 @@ namespace pulsar
         m_runtimeWorld = nullptr;
     }
 
-    void Scene::Tick(Ticker ticker)
-    {
-        for (auto& node : *GetNodes())
-        {
-            if (node && node->GetIsActive())
-            {
-                node->OnTick(ticker);
-            }
-        }
-    }
     void Scene::BeginPlay()
     {
         for (auto& node : *GetNodes())
@@ -0,0 +1,134 @@
+#include <Pulsar/TickManager.h>
+#include "Application.h"
+#include "Components/Component.h"
+#include "JobSystem.h"
+
+namespace pulsar
+{
+    // reading a world matrix may rebuild the transform order and the dirty range, so a read is a write
+    static constexpr TickAccess kWritingReads = TickAccess::Transform;
+
+    static bool IsConflicting(TickAccess reads, TickAccess writes, TickAccess otherReads, TickAccess otherWrites)
+    {
+        writes |= reads & kWritingReads;
+        otherWrites |= otherReads & kWritingReads;
+        return (writes & (otherReads | otherWrites)) != TickAccess::None || (reads & otherWrites) != TickAccess::None;
+    }
+
+    void TickManager::AddComponent(Component* component)
+    {
+        auto& components = m_components[static_cast<size_t>(component->m_tickGroup)];
+        component->m_tickIndex = static_cast<uint32_t>(components.size());
+        components.push_back({component, component->m_tickReads, component->m_tickWrites});
+    }
+
+    void TickManager::RemoveComponent(Component* component)
+    {
+        auto& components = m_components[static_cast<size_t>(component->m_tickGroup)];
+        const auto index = component->m_tickIndex;
+        component->m_tickIndex = Component::kInvalidTickIndex;
+
+        // only ticks that write the hierarchy remove components, and those run alone
+        if (m_isRunning)
+        {
+            components[index].Owner = nullptr;
+            m_hasTombstones = true;
+            return;
+        }
+        components[index] = components.back();
+        components[index].Owner->m_tickIndex = index;
+        components.pop_back();
+    }
+
+    void TickManager::AddSystemTick(TickGroup group, TickAccess reads, TickAccess writes, std::function<void(Ticker)> func)
+    {
+        m_systems[static_cast<size_t>(group)].push_back({std::move(func), reads, writes});
+    }
+
+    void TickManager::Schedule(PhaseTick tick, TickAccess reads, TickAccess writes, Ticker ticker)
+    {
+        // hierarchy writers run alone, they may begin or end components of any group
+        const bool isExclusive = EnumHasFlag(writes, TickAccess::Hierarchy);
+        if (isExclusive || IsConflicting(reads, writes, m_phaseReads, m_phaseWrites))
+        {
+            FlushPhase(ticker);
+        }
+        m_phase.push_back(tick);
+        m_phaseReads |= reads;
+        m_phaseWrites |= writes;
+
+        if (isExclusive)
+        {
+            FlushPhase(ticker);
+        }
+    }
+
+    void TickManager::FlushPhase(Ticker ticker)
+    {
+        auto runTick = [&](size_t index) {
+            const auto& tick = m_phase[index];
+            if (tick.System)
+            {
+                tick.System->Func(ticker);
+            }
+            else
+            {
+                tick.Owner->OnTick(ticker);
+            }
+        };
+
+        const auto jobSystem = Application::GetJobSystem();
+        if (m_phase.size() > 1 && jobSystem)
+        {
+            jobSystem->ParallelFor(m_phase.size(), runTick);
+        }
+        else if (!m_phase.empty())
+        {
+            runTick(0);
+        }
+        m_phase.clear();
+        m_phaseReads = TickAccess::None;
+        m_phaseWrites = TickAccess::None;
+    }
+
+    void TickManager::RunGroup(TickGroup group, Ticker ticker)
+    {
+        const auto groupIndex = static_cast<size_t>(group);
+        m_isRunning = true;
+
+        for (const auto& system : m_systems[groupIndex])
+        {
+            Schedule({nullptr, &system}, system.Reads, system.Writes, ticker);
+        }
+        // indexed, components begun by a tick are appended and still tick this frame
+        auto& components = m_components[groupIndex];
+        for (size_t i = 0; i < components.size(); ++i)
+        {
+            const auto entry = components[i];
+            if (entry.Owner)
+            {
+                Schedule({entry.Owner, nullptr}, entry.Reads, entry.Writes, ticker);
+            }
+        }
+        FlushPhase(ticker);
+
+        m_isRunning = false;
+        if (m_hasTombstones)
+        {
+            RemoveTombstones();
+        }
+    }
+
+    void TickManager::RemoveTombstones()
+    {
+        m_hasTombstones = false;
+        for (auto& components : m_components)
+        {
+            std::erase_if(components, [](const ComponentEntry& entry) { return entry.Owner == nullptr; });
+            for (size_t i = 0; i < components.size(); ++i)
+            {
+                components[i].Owner->m_tickIndex = static_cast<uint32_t>(i);
+            }
+        }
+    }
+}
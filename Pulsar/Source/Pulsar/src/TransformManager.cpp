@@ -0,0 +1,301 @@
+#include <Pulsar/TransformManager.h>
+#include "Components/TransformComponent.h"
+#include "Node.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define PULSAR_TRANSFORM_SSE 1
+#endif
+
+namespace pulsar
+{
+    static void ComposeTRS(Matrix4f& mat, const Vector3f& t, const Quat4f& q, const Vector3f& s)
+    {
+        mat = jmath::Rotate(q);
+        mat[0] = mat[0] * s.x;
+        mat[1] = mat[1] * s.y;
+        mat[2] = mat[2] * s.z;
+        mat[3] = Vector4f{t.x, t.y, t.z, 1.f};
+    }
+
+    // both matrices are affine, the last row of b is (0, 0, 0, 1)
+    static void AffineMultiply(Matrix4f& out, const Matrix4f& a, const Matrix4f& b)
+    {
+#ifdef PULSAR_TRANSFORM_SSE
+        const __m128 a0 = _mm_loadu_ps(&a[0].x);
+        const __m128 a1 = _mm_loadu_ps(&a[1].x);
+        const __m128 a2 = _mm_loadu_ps(&a[2].x);
+        const __m128 a3 = _mm_loadu_ps(&a[3].x);
+        for (int i = 0; i < 4; ++i)
+        {
+            __m128 col = _mm_mul_ps(a0, _mm_set1_ps(b[i].x));
+            col = _mm_add_ps(col, _mm_mul_ps(a1, _mm_set1_ps(b[i].y)));
+            col = _mm_add_ps(col, _mm_mul_ps(a2, _mm_set1_ps(b[i].z)));
+            if (i == 3)
+            {
+                col = _mm_add_ps(col, a3);
+            }
+            _mm_storeu_ps(&out[i].x, col);
+        }
+#else
+        for (int i = 0; i < 3; ++i)
+        {
+            out[i] = a[0] * b[i].x + a[1] * b[i].y + a[2] * b[i].z;
+        }
+        out[3] = a[0] * b[3].x + a[1] * b[3].y + a[2] * b[3].z + a[3];
+#endif
+    }
+
+    static Matrix4f AffineInverse(const Matrix4f& mat)
+    {
+        const Vector3f c0{mat[0].x, mat[0].y, mat[0].z};
+        const Vector3f c1{mat[1].x, mat[1].y, mat[1].z};
+        const Vector3f c2{mat[2].x, mat[2].y, mat[2].z};
+        const Vector3f t{mat[3].x, mat[3].y, mat[3].z};
+
+        const auto r0 = Cross(c1, c2);
+        const auto det = Dot(c0, r0);
+        if (std::abs(det) < 1e-12f)
+        {
+            return Inverse(mat);
+        }
+        const auto invDet = 1.f / det;
+        const auto i0 = r0 * invDet;
+        const auto i1 = Cross(c2, c0) * invDet;
+        const auto i2 = Cross(c0, c1) * invDet;
+
+        return Matrix4f{
+            i0.x, i0.y, i0.z, -Dot(i0, t),
+            i1.x, i1.y, i1.z, -Dot(i1, t),
+            i2.x, i2.y, i2.z, -Dot(i2, t),
+            0.f, 0.f, 0.f, 1.f
+        };
+    }
+
+    template<typename T>
+    static void Permute(array_list<T>& items, const array_list<uint32_t>& order)
+    {
+        array_list<T> sorted;
+        sorted.reserve(order.size());
+        for (const auto index : order)
+        {
+            sorted.push_back(items[index]);
+        }
+        items = std::move(sorted);
+    }
+
+    uint32_t TransformManager::FindParentIndex(const TransformComponent* owner) const
+    {
+        const auto parent = owner->m_parent.GetPtr();
+        if (parent && parent->m_transformManager == this && parent->m_transformHandle != kInvalidHandle)
+        {
+            return m_handleToIndex[parent->m_transformHandle];
+        }
+        return kNoParent;
+    }
+
+    uint32_t TransformManager::Register(TransformComponent* owner)
+    {
+        uint32_t handle;
+        if (!m_freeHandles.empty())
+        {
+            handle = m_freeHandles.back();
+            m_freeHandles.pop_back();
+        }
+        else
+        {
+            handle = static_cast<uint32_t>(m_handleToIndex.size());
+            m_handleToIndex.push_back(0);
+        }
+
+        // appended entries stay behind their parent, only registered children break the order
+        const auto index = static_cast<uint32_t>(m_owners.size());
+        m_handleToIndex[handle] = index;
+        m_positions.push_back(owner->m_position);
+        m_rotations.push_back(owner->m_rotation);
+        m_scales.push_back(owner->m_scale);
+        m_parents.push_back(FindParentIndex(owner));
+        m_localToWorld.emplace_back(1.f);
+        m_worldToLocal.emplace_back(1.f);
+        m_flags.push_back(Flags_Dirty);
+        m_owners.push_back(owner);
+        m_indexToHandle.push_back(handle);
+        m_firstDirty = std::min<size_t>(m_firstDirty, index);
+
+        for (const auto& child : *owner->m_children)
+        {
+            const auto childPtr = child.GetPtr();
+            if (childPtr && childPtr->m_transformManager == this && childPtr->m_transformHandle != kInvalidHandle)
+            {
+                m_isOrderDirty = true;
+                MarkDirty(m_handleToIndex[childPtr->m_transformHandle]);
+            }
+        }
+        return handle;
+    }
+
+    void TransformManager::Unregister(uint32_t handle)
+    {
+        const auto index = m_handleToIndex[handle];
+        m_owners[index] = nullptr;
+        m_flags[index] = 0;
+        m_handleToIndex[handle] = kNoParent;
+        m_freeHandles.push_back(handle);
+        m_isOrderDirty = true;
+    }
+
+    void TransformManager::MarkDirty(uint32_t index)
+    {
+        m_flags[index] |= Flags_Dirty;
+        m_firstDirty = std::min<size_t>(m_firstDirty, index);
+    }
+
+    void TransformManager::SetLocalTransform(uint32_t handle, const Vector3f& position, const Quat4f& rotation, const Vector3f& scale)
+    {
+        const auto index = m_handleToIndex[handle];
+        m_positions[index] = position;
+        m_rotations[index] = rotation;
+        m_scales[index] = scale;
+        MarkDirty(index);
+    }
+
+    const Matrix4f& TransformManager::GetLocalToWorldMatrix(uint32_t handle)
+    {
+        if (m_isOrderDirty)
+        {
+            RebuildOrder();
+        }
+        const auto index = m_handleToIndex[handle];
+        if (index >= m_firstDirty)
+        {
+            UpdateRange(m_firstDirty, index + 1);
+            m_firstDirty = index + 1;
+        }
+        return m_localToWorld[index];
+    }
+
+    const Matrix4f& TransformManager::GetWorldToLocalMatrix(uint32_t handle)
+    {
+        const auto& localToWorld = GetLocalToWorldMatrix(handle);
+        const auto index = m_handleToIndex[handle];
+        if (!(m_flags[index] & Flags_InverseValid))
+        {
+            m_worldToLocal[index] = AffineInverse(localToWorld);
+            m_flags[index] |= Flags_InverseValid;
+        }
+        return m_worldToLocal[index];
+    }
+
+    void TransformManager::UpdateRange(size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (!m_owners[i])
+            {
+                continue;
+            }
+            const auto parent = m_parents[i];
+            const bool isParentChanged = parent != kNoParent && (m_flags[parent] & Flags_Changed);
+            if (!(m_flags[i] & Flags_Dirty) && !isParentChanged)
+            {
+                continue;
+            }
+
+            auto& localToWorld = m_localToWorld[i];
+            ComposeTRS(localToWorld, m_positions[i], m_rotations[i], m_scales[i]);
+            if (parent != kNoParent)
+            {
+                const auto local = localToWorld;
+                AffineMultiply(localToWorld, m_localToWorld[parent], local);
+            }
+            m_flags[i] = static_cast<uint8_t>((m_flags[i] & ~(Flags_Dirty | Flags_InverseValid)) | Flags_Changed);
+        }
+    }
+
+    void TransformManager::RebuildOrder()
+    {
+        m_isOrderDirty = false;
+        const auto count = static_cast<uint32_t>(m_owners.size());
+
+        array_list<uint32_t> depths(count, kNoParent);
+        auto getDepth = [&](auto& self, uint32_t index) -> uint32_t
+        {
+            if (depths[index] == kNoParent)
+            {
+                const auto parent = FindParentIndex(m_owners[index]);
+                depths[index] = parent == kNoParent ? 0 : self(self, parent) + 1;
+            }
+            return depths[index];
+        };
+
+        // removed entries are dropped here
+        array_list<uint32_t> order;
+        order.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (m_owners[i])
+            {
+                getDepth(getDepth, i);
+                order.push_back(i);
+            }
+        }
+        std::ranges::stable_sort(order, {}, [&](uint32_t index) { return depths[index]; });
+
+        Permute(m_positions, order);
+        Permute(m_rotations, order);
+        Permute(m_scales, order);
+        Permute(m_localToWorld, order);
+        Permute(m_worldToLocal, order);
+        Permute(m_flags, order);
+        Permute(m_owners, order);
+        Permute(m_indexToHandle, order);
+
+        const auto newCount = order.size();
+        for (uint32_t i = 0; i < newCount; ++i)
+        {
+            m_handleToIndex[m_indexToHandle[i]] = i;
+        }
+        m_parents.resize(newCount);
+        m_firstDirty = newCount;
+        for (uint32_t i = 0; i < newCount; ++i)
+        {
+            m_parents[i] = FindParentIndex(m_owners[i]);
+            if (m_flags[i] & Flags_Dirty)
+            {
+                m_firstDirty = std::min<size_t>(m_firstDirty, i);
+            }
+        }
+    }
+
+    void TransformManager::Update()
+    {
+        if (m_isOrderDirty)
+        {
+            RebuildOrder();
+        }
+        const auto count = m_owners.size();
+        UpdateRange(m_firstDirty, count);
+        m_firstDirty = count;
+
+        // handlers may move or destroy nodes, so they run after the pass
+        array_list<ObjectPtr<Node>> changedNodes;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (m_flags[i] & Flags_Changed)
+            {
+                m_flags[i] &= ~Flags_Changed;
+                m_owners[i]->m_localToWorldMatrix = m_localToWorld[i];
+                changedNodes.push_back(m_owners[i]->GetNode());
+            }
+        }
+        for (const auto& node : changedNodes)
+        {
+            if (node)
+            {
+                node->OnTransformChanged();
+            }
+        }
+    }
+}
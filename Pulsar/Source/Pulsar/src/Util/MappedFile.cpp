@@ -0,0 +1,99 @@
+#include "Util/MappedFile.h"
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace pulsar
+{
+#ifdef _WIN32
+    std::shared_ptr<MappedFile> MappedFile::Open(const std::filesystem::path& path)
+    {
+        auto mapped = std::make_shared<MappedFile>();
+        const auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+        mapped->m_file = file;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            return nullptr;
+        }
+        mapped->m_size = static_cast<size_t>(size.QuadPart);
+
+        mapped->m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapped->m_mapping)
+        {
+            return nullptr;
+        }
+        mapped->m_data = static_cast<const uint8_t*>(MapViewOfFile(mapped->m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!mapped->m_data)
+        {
+            return nullptr;
+        }
+        return mapped;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (m_data)
+        {
+            UnmapViewOfFile(m_data);
+        }
+        if (m_mapping)
+        {
+            CloseHandle(m_mapping);
+        }
+        if (m_file)
+        {
+            CloseHandle(m_file);
+        }
+    }
+#else
+    std::shared_ptr<MappedFile> MappedFile::Open(const std::filesystem::path& path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return nullptr;
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            ::close(fd);
+            return nullptr;
+        }
+        void* data = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        // the mapping stays valid after closing the descriptor
+        ::close(fd);
+        if (data == MAP_FAILED)
+        {
+            return nullptr;
+        }
+
+        auto mapped = std::make_shared<MappedFile>();
+        mapped->m_data = static_cast<const uint8_t*>(data);
+        mapped->m_size = static_cast<size_t>(st.st_size);
+        return mapped;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (m_data)
+        {
+            ::munmap(const_cast<uint8_t*>(m_data), m_size);
+        }
+    }
+#endif
+}
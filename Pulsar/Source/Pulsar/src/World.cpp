@@ -52,6 +52,12 @@ namespace pulsar
         : m_name(name), m_gizmosManager(this)
     {
         gWorlds.insert(this);
+
+        // both steps push body transforms back into their components
+        m_tickManager.AddSystemTick(TickGroup::Physics, TickAccess::Physics | TickAccess::Transform, TickAccess::Physics | TickAccess::Transform,
+            [this](Ticker ticker) { m_physicsWorld2D->Tick(ticker.deltatime); });
+        m_tickManager.AddSystemTick(TickGroup::Physics, TickAccess::Physics | TickAccess::Transform, TickAccess::Physics | TickAccess::Transform,
+            [this](Ticker ticker) { m_physicsWorld3D->StepSimulate(ticker.deltatime); });
     }
 
     World::~World()
@@ -129,16 +135,14 @@ namespace pulsar
 
         if (m_isPlaying)
         {
-            for (auto& scene : m_scenes)
-            {
-                if (scene)
-                {
-                    scene->Tick(m_ticker);
-                }
-            }
-            m_physicsWorld2D->Tick(dt);
-            m_physicsWorld3D->StepSimulate(dt);
+            m_tickManager.RunGroup(TickGroup::PrePhysics, m_ticker);
+            m_tickManager.RunGroup(TickGroup::Physics, m_ticker);
+            m_tickManager.RunGroup(TickGroup::PostPhysics, m_ticker);
+            m_tickManager.RunGroup(TickGroup::Late, m_ticker);
         }
+
+        m_transformManager.Update();
+        m_deferredDestroyedQueue.Process(RuntimeObjectManager::MakeGCollectDeadline());
     }
 
     bool World::IsSelectedNode(const ObjectPtr<Node>& node) const
@@ -226,7 +230,7 @@ namespace pulsar
         }
         else
         {
-            if (m_focusScene.Handle == scene.Handle)
+            if (m_focusScene.GetHandle() == scene.GetHandle())
             {
                 m_focusScene = GetResidentScene();
             }
@@ -294,12 +298,14 @@ namespace pulsar
     {
         renderObject->OnCreateResource();
         m_renderObjects.insert(renderObject);
+        m_meshBatchCache.Add(renderObject.get());
     }
     void World::RemoveRenderObject(rendering::RenderObject_rsp renderObject)
     {
         const auto it = m_renderObjects.find(renderObject);
         if (it != m_renderObjects.end())
         {
+            m_meshBatchCache.Remove(it->get());
             (*it)->OnDestroyResource();
             m_renderObjects.erase(it);
         }
@@ -360,11 +366,10 @@ namespace pulsar
         m_subsystems.clear();
 
         UnloadAllScene();
-        for (const auto& i : m_deferredDestroyedQueue)
-        {
-            DestroyObject(i);
-        }
-        m_deferredDestroyedQueue.clear();
+        m_deferredDestroyedQueue.Drain();
+        RuntimeObjectManager::DrainGCollect();
+
+        m_meshBatchCache.Clear();
 
         m_worldDescriptorLayout.reset();
         m_worldDescriptorBuffer.reset();
@@ -0,0 +1,115 @@
+#pragma once
+#include <gfx/GFXApplication.h>
+#include "GFXNullStatistics.h"
+#include <mutex>
+
+namespace gfx
+{
+    // headless backend without a device or window. resources live in host memory, command buffers
+    // record into an in memory stream and everything asked of the backend is counted in GFXNullStatistics,
+    // so the cpu side of a frame can be run and measured on machines without a gpu.
+    class GFXNullApplication : public GFXApplication
+    {
+    public:
+        explicit GFXNullApplication(GFXGlobalConfig config)
+        {
+            m_config = config;
+        }
+        ~GFXNullApplication() override = default;
+
+    public:
+        virtual void Initialize() override;
+        // runs frames with a fixed delta time until RequestStop, or HeadlessFrameCount frames when it is set
+        virtual void ExecLoop() override;
+        virtual void RequestStop() override;
+        virtual void Terminate() override;
+
+        void TickRender(float deltaTime);
+
+        virtual GFXApi GetApiType() const override { return GFXApi::Null; }
+        virtual GFXApi GetShaderApiType() const override { return GFXApi::Vulkan; }
+        virtual const char* GetApiLevelName() const override { return "Null"; }
+        virtual GFXExtensions GetExtensionNames() override { return GFXExtensions(nullptr, 0); }
+
+        virtual void SetRenderPipeline(GFXRenderPipeline* pipeline) override { m_renderPipeline = pipeline; }
+        virtual GFXRenderPipeline* GetRenderPipeline() const override { return m_renderPipeline; }
+
+        virtual GFXRenderer* GetRenderer() override;
+
+        virtual GFXBuffer_sp CreateBuffer(GFXBufferUsage usage, size_t bufferSize) override;
+        virtual GFXCommandBuffer_sp CreateCommandBuffer() override;
+        virtual GFXVertexLayoutDescription_sp CreateVertexLayoutDescription() override;
+        virtual GFXGpuProgram_sp CreateGpuProgram(const std::unordered_map<gfx::GFXShaderStageFlags, array_list<char>>& codes) override;
+        virtual GFXShaderPass_sp CreateShaderPass(
+            const GFXShaderPassConfig& config,
+            const GFXGpuProgram_sp& gpuProgram) override;
+
+        virtual GFXDescriptorManager* GetDescriptorManager() override;
+        virtual GFXDynamicBuffer* GetDynamicBuffer() override;
+        virtual GFXMemoryStatistics GetMemoryStatistics() const override;
+
+        virtual GFXDescriptorSetLayout_sp CreateDescriptorSetLayout(
+            const GFXDescriptorSetLayoutInfo* layouts,
+            size_t layoutCount) override;
+
+        virtual GFXGraphicsPipelineManager* GetGraphicsPipelineManager() const override;
+
+        virtual GFXTexture_sp CreateTexture2DFromMemory(
+            const uint8_t* imageData, size_t length,
+            int width, int height,
+            GFXTextureFormat format,
+            const GFXSamplerConfig& samplerConfig
+            ) override;
+
+        virtual GFXTexture_sp CreateTextureCube(int32_t size) override;
+
+        virtual GFXTexture_sp CreateRenderTarget(
+            int32_t width, int32_t height, GFXTextureTargetType type,
+            GFXTextureFormat format, const GFXSamplerConfig& samplerCfg) override;
+
+        virtual GFXFrameBufferObject_sp CreateFrameBufferObject(
+            const array_list<GFXTexture2DView_sp>& renderTargets,
+            const GFXRenderPassLayout_sp& renderPassLayout) override;
+
+        virtual GFXRenderPassLayout_sp CreateRenderPassLayout(const array_list<GFXTexture2DView*>& renderTargets) override;
+
+        virtual array_list<GFXTextureFormat> GetSupportedDepthFormats() override;
+
+        virtual intptr_t GetWindowHandle() override { return 0; }
+
+        virtual GFXViewport* GetViewport() override;
+
+    public:
+        class GFXNullDynamicBuffer* GetNullDynamicBuffer() const { return m_dynamicBuffer; }
+
+        // thread safe
+        GFXNullStatistics GetStatistics() const;
+        void ResetStatistics();
+
+        // called by the null resources, thread safe
+        void CountBufferAllocation(size_t size);
+        void CountTextureAllocation(size_t size);
+        void CountRelease(size_t size);
+        void CountBufferUpload(size_t size);
+        void CountDescriptorSetAllocation();
+        void CountDescriptorSetUpdate();
+        void CountPipelineCreate();
+        void CountSubmit(const class GFXNullCommandBuffer& cmdBuffer);
+
+        static constexpr float kFixedDeltaTime = 1.f / 60.f;
+        static constexpr int kFramesInFlight = 2;
+    protected:
+        GFXRenderPipeline* m_renderPipeline = nullptr;
+
+        class GFXNullViewport* m_viewport = nullptr;
+        class GFXNullRenderer* m_renderer = nullptr;
+        class GFXNullDescriptorManager* m_descriptorManager = nullptr;
+        class GFXNullDynamicBuffer* m_dynamicBuffer = nullptr;
+        class GFXNullGraphicsPipelineManager* m_graphicsPipelineManager = nullptr;
+
+        mutable std::mutex m_statisticsMutex;
+        GFXNullStatistics m_statistics{};
+
+        bool m_isAppEnding = false;
+    };
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <gfx/GFXBuffer.h>
+#include <vector>
+
+namespace gfx
+{
+    class GFXNullApplication;
+
+    // host memory only, Fill is counted as an upload
+    class GFXNullBuffer : public GFXBuffer
+    {
+        using base = GFXBuffer;
+    public:
+        GFXNullBuffer(GFXNullApplication* app, GFXBufferUsage usage, size_t bufferSize);
+        virtual ~GFXNullBuffer() override;
+    public:
+        virtual void Fill(const void* data) override;
+        virtual void Release() override;
+        virtual size_t GetSize() const override { return m_bufferSize; }
+        virtual bool IsValid() const override { return m_isValid; }
+
+        uint8_t* GetData() { return m_data.data(); }
+        const uint8_t* GetData() const { return m_data.data(); }
+        GFXBufferUsage GetUsage() const { return m_usage; }
+    protected:
+        GFXNullApplication* m_app;
+        std::vector<uint8_t> m_data;
+        bool m_isValid = true;
+    };
+}
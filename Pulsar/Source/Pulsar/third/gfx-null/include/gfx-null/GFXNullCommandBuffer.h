@@ -0,0 +1,88 @@
+#pragma once
+#include <gfx/GFXCommandBindState.h>
+#include <gfx/GFXCommandBuffer.h>
+
+namespace gfx
+{
+    class GFXNullApplication;
+
+    enum class GFXNullCommandType : uint8_t
+    {
+        BindGraphicsPipeline,
+        BindVertexBuffers,
+        BindIndexBuffer,
+        BindDescriptorSets,
+        Draw,
+        DrawIndexed,
+        ClearColor,
+        BeginFrameBuffer,
+        EndFrameBuffer,
+        SetViewport,
+        SetCullMode,
+        Blit,
+        ImageTransitionBarrier,
+    };
+
+    // one recorded command, the meaning of the arguments depends on the type
+    struct GFXNullCommand
+    {
+        GFXNullCommandType Type;
+        const void* Object;
+        uint64_t Arg0;
+        uint64_t Arg1;
+    };
+
+    // records into an in memory command stream, binds are filtered the same way as on vulkan
+    class GFXNullCommandBuffer : public GFXCommandBuffer
+    {
+    public:
+        explicit GFXNullCommandBuffer(GFXNullApplication* app)
+            : m_app(app)
+        {
+        }
+
+        virtual void Begin() override;
+        virtual void End() override;
+        virtual void SetFrameBuffer(GFXFrameBufferObject* framebuffer) override { m_fbo = framebuffer; }
+
+        virtual void CmdBindGraphicsPipeline(GFXGraphicsPipeline* pipeline) override;
+        virtual void CmdBindVertexBuffers(const std::vector<GFXBuffer*>& buffers) override;
+        virtual void CmdBindIndexBuffer(GFXBuffer* buffer) override;
+        virtual void CmdBindDescriptorSets(
+            const array_list<GFXDescriptorSet*>& descriptorSet, GFXGraphicsPipeline* pipeline,
+            const array_list<uint32_t>& dynamicOffsets = {}) override;
+        virtual void CmdDraw(size_t vertexCount) override;
+        virtual void CmdDrawIndexed(size_t indicesCount, uint32_t instanceCount = 1) override;
+        virtual void CmdClearColor(GFXTexture* rt, float r, float g, float b, float a) override;
+        virtual void CmdClearColor(GFXTexture* rt) override;
+
+        virtual void CmdBeginFrameBuffer() override;
+        virtual void CmdEndFrameBuffer() override;
+        virtual void CmdSetViewport(float x, float y, float width, float height) override;
+        virtual void CmdSetCullMode(GFXCullMode mode) override;
+        virtual void CmdBlit(GFXTextureView* src, GFXTextureView* dest) override;
+        virtual void CmdImageTransitionBarrier(GFXTextureView* rt, GFXResourceLayout layout) override;
+    public:
+        virtual GFXApplication* GetApplication() const override;
+        virtual const GFXCommandBufferStats& GetStats() const override { return m_stats; }
+
+        // commands recorded since Begin()
+        const array_list<GFXNullCommand>& GetCommands() const { return m_commands; }
+        bool IsRecorded() const { return m_isRecorded; }
+    protected:
+        void Record(GFXNullCommandType type, const void* object, uint64_t arg0 = 0, uint64_t arg1 = 0)
+        {
+            m_commands.push_back({type, object, arg0, arg1});
+        }
+
+        using BindState = GFXCommandBindState<
+            const GFXGraphicsPipeline*, const GFXBuffer*, const GFXDescriptorSet*, const GFXDescriptorSetLayout*>;
+
+        GFXNullApplication* m_app;
+        GFXFrameBufferObject* m_fbo = nullptr;
+        array_list<GFXNullCommand> m_commands;
+        BindState m_bindState{};
+        GFXCommandBufferStats m_stats{};
+        bool m_isRecorded = false;
+    };
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <gfx/GFXDescriptorManager.h>
+
+namespace gfx
+{
+    class GFXNullApplication;
+
+    class GFXNullDescriptorManager : public GFXDescriptorManager
+    {
+    public:
+        explicit GFXNullDescriptorManager(GFXNullApplication* app)
+            : m_app(app)
+        {
+        }
+        virtual std::shared_ptr<GFXDescriptorSet> GetDescriptorSet(GFXDescriptorSetLayout_sp layout) override;
+    protected:
+        GFXNullApplication* m_app;
+    };
+}
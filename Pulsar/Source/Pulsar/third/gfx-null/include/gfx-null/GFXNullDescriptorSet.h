@@ -0,0 +1,81 @@
+#pragma once
+#include <gfx/GFXDescriptorSet.h>
+#include <memory>
+#include <vector>
+
+namespace gfx
+{
+    class GFXNullApplication;
+
+    class GFXNullDescriptorSetLayout : public GFXDescriptorSetLayout
+    {
+        using base = GFXDescriptorSetLayout;
+    public:
+        GFXNullDescriptorSetLayout(const GFXDescriptorSetLayoutInfo* layouts, size_t layoutCount);
+        virtual ~GFXNullDescriptorSetLayout() override = default;
+    public:
+        // number of dynamic offsets a set of this layout takes when bound
+        uint32_t GetDynamicDescriptorCount() const { return m_dynamicDescriptorCount; }
+    protected:
+        uint32_t m_dynamicDescriptorCount{};
+    };
+    GFX_DECL_SPTR(GFXNullDescriptorSetLayout);
+
+    class GFXNullDescriptor : public GFXDescriptor
+    {
+    public:
+        explicit GFXNullDescriptor(uint32_t bindingPoint)
+            : m_bindingPoint(bindingPoint)
+        {
+            IsDirty = false;
+        }
+        virtual void SetConstantBuffer(GFXBuffer* buffer) override;
+        virtual void SetStructuredBuffer(GFXBuffer* buffer) override;
+        virtual void SetTextureSampler2D(GFXTexture2DView* texture) override;
+        virtual void SetTexture2D(GFXTexture* texture) override;
+        virtual void SetDynamicConstantBuffer(GFXBuffer* buffer, size_t range) override;
+        virtual void SetDynamicStructuredBuffer(GFXBuffer* buffer, size_t range) override;
+
+        uint32_t GetBindingPoint() const { return m_bindingPoint; }
+        GFXBuffer* GetBuffer() const { return m_buffer; }
+        GFXTexture* GetTexture() const { return m_texture; }
+        GFXTexture2DView* GetTextureView() const { return m_textureView; }
+        size_t GetRange() const { return m_range; }
+    protected:
+        void SetBuffer(GFXBuffer* buffer, size_t range);
+
+        uint32_t m_bindingPoint;
+        GFXBuffer* m_buffer = nullptr;
+        GFXTexture* m_texture = nullptr;
+        GFXTexture2DView* m_textureView = nullptr;
+        size_t m_range{};
+    };
+
+    class GFXNullDescriptorSet : public GFXDescriptorSet
+    {
+        using base = GFXDescriptorSet;
+    public:
+        GFXNullDescriptorSet(GFXNullApplication* app, const GFXDescriptorSetLayout_sp& layout);
+        virtual ~GFXNullDescriptorSet() override;
+        GFXNullDescriptorSet(const GFXNullDescriptorSet&) = delete;
+    public:
+        virtual GFXDescriptor* AddDescriptor(std::string_view name, uint32_t bindingPoint) override;
+        virtual GFXDescriptor* GetDescriptorAt(int index) override;
+        virtual int32_t GetDescriptorCount() const override;
+        virtual GFXDescriptor* Find(std::string_view name) override;
+        virtual GFXDescriptor* FindByBinding(uint32_t bindingPoint) override;
+        virtual void Submit() override;
+        virtual intptr_t GetId() override { return reinterpret_cast<intptr_t>(this); }
+        virtual GFXDescriptorSetLayout_sp GetDescriptorSetLayout() const override { return m_setlayout; }
+
+        const GFXNullDescriptorSetLayout* GetNullDescriptorSetLayout() const
+        {
+            return static_cast<const GFXNullDescriptorSetLayout*>(m_setlayout.get());
+        }
+    protected:
+        GFXNullApplication* m_app;
+        std::vector<std::unique_ptr<GFXNullDescriptor>> m_descriptors;
+        GFXDescriptorSetLayout_sp m_setlayout;
+    };
+    GFX_DECL_SPTR(GFXNullDescriptorSet);
+}
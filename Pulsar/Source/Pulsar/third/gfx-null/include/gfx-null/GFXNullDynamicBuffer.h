@@ -0,0 +1,54 @@
+#pragma once
+#include <gfx/GFXDynamicBuffer.h>
+#include "GFXNullBuffer.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace gfx
+{
+    class GFXNullApplication;
+
+    // same ring layout and alignment rules as the vulkan one, backed by host memory
+    class GFXNullDynamicBuffer : public GFXDynamicBuffer
+    {
+    public:
+        GFXNullDynamicBuffer(GFXNullApplication* app, size_t frameCapacity, size_t maxBindingRange, uint32_t frameCount);
+    public:
+        // thread safe
+        virtual GFXDynamicBufferAllocation Allocate(size_t size) override;
+        virtual void Reserve(size_t allocationCount, size_t allocationSize) override;
+
+        virtual GFXBuffer* GetBuffer() const override { return m_buffer.get(); }
+        virtual size_t GetMaxBindingRange() const override { return m_maxBindingRange; }
+        virtual size_t GetFrameCapacity() const override { return m_frameCapacity; }
+        virtual size_t GetFrameUsedSize() const override { return std::min(m_frameUsedSize.load(), m_frameCapacity); }
+
+        void BeginFrame(uint32_t frameIndex);
+
+        uint64_t GetAllocationCount() const { return m_allocationCount.load(std::memory_order_relaxed); }
+        uint64_t GetAllocationSize() const { return m_allocationSize.load(std::memory_order_relaxed); }
+        void ResetAllocationCount()
+        {
+            m_allocationCount = 0;
+            m_allocationSize = 0;
+        }
+
+        static constexpr size_t kAlignment = 256;
+    protected:
+        void CreateBuffer();
+
+        GFXNullApplication* m_app;
+        std::unique_ptr<GFXNullBuffer> m_buffer;
+
+        size_t m_frameCapacity{};
+        size_t m_maxBindingRange{};
+        uint32_t m_frameCount{};
+
+        uint32_t m_frameIndex{};
+        std::atomic<size_t> m_frameUsedSize{};
+
+        std::atomic<uint64_t> m_allocationCount{};
+        std::atomic<uint64_t> m_allocationSize{};
+    };
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <gfx/GFXFrameBufferObject.h>
+#include <gfx/GFXRenderPass.h>
+
+namespace gfx
+{
+    class GFXNullRenderPassLayout : public GFXRenderPassLayout
+    {
+    public:
+        explicit GFXNullRenderPassLayout(const array_list<GFXTexture2DView*>& renderTargets);
+        const array_list<GFXTextureFormat>& GetFormats() const { return m_formats; }
+    protected:
+        array_list<GFXTextureFormat> m_formats;
+    };
+
+    class GFXNullFrameBufferObject : public GFXFrameBufferObject
+    {
+    public:
+        GFXNullFrameBufferObject(const array_list<GFXTexture2DView_sp>& renderTargets, const GFXRenderPassLayout_sp& renderPass);
+
+        virtual int32_t GetWidth() const override { return m_width; }
+        virtual int32_t GetHeight() const override { return m_height; }
+        virtual GFXRenderPassLayout_sp GetRenderPassLayout() const override { return m_renderPass; }
+        virtual const array_list<GFXTexture2DView_sp>& GetRenderTargets() const override { return m_renderTargets; }
+    protected:
+        array_list<GFXTexture2DView_sp> m_renderTargets;
+        GFXRenderPassLayout_sp m_renderPass;
+        int32_t m_width{};
+        int32_t m_height{};
+    };
+}
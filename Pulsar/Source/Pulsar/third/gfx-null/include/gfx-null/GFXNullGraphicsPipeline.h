@@ -0,0 +1,62 @@
+#pragma once
+#include <gfx/GFXGraphicsPipeline.h>
+#include <gfx/GFXGraphicsPipelineKey.h>
+#include <gfx/GFXGraphicsPipelineManager.h>
+#include <mutex>
+#include <unordered_map>
+
+namespace gfx
+{
+    class GFXNullApplication;
+
+    class GFXNullGraphicsPipeline : public GFXGraphicsPipeline
+    {
+    public:
+        GFXNullGraphicsPipeline(
+            const std::shared_ptr<GFXShaderPass>& shaderPass,
+            const array_list<GFXDescriptorSetLayout_sp>& descriptorSetLayouts,
+            const GFXGraphicsPipelineState& gpInfo)
+            : m_shaderPass(shaderPass.get()), m_descriptorSetLayouts(descriptorSetLayouts), m_state(gpInfo)
+        {
+        }
+        const GFXShaderPass* GetShaderPass() const { return m_shaderPass; }
+        const array_list<GFXDescriptorSetLayout_sp>& GetDescriptorSetLayouts() const { return m_descriptorSetLayouts; }
+        const GFXGraphicsPipelineState& GetState() const { return m_state; }
+    protected:
+        // not owned, the manager drops the pipeline once the pass is destroyed
+        const GFXShaderPass* m_shaderPass;
+        array_list<GFXDescriptorSetLayout_sp> m_descriptorSetLayouts;
+        GFXGraphicsPipelineState m_state;
+    };
+
+    // same keying as the vulkan manager, so the pipeline create count matches a real run
+    class GFXNullGraphicsPipelineManager : public GFXGraphicsPipelineManager
+    {
+    public:
+        explicit GFXNullGraphicsPipelineManager(GFXNullApplication* app)
+            : m_app(app)
+        {
+        }
+    public:
+        // thread safe
+        virtual std::shared_ptr<GFXGraphicsPipeline> GetGraphicsPipeline(
+            const std::shared_ptr<GFXShaderPass>& shaderPass,
+            const array_list<GFXDescriptorSetLayout_sp>& descriptorSetLayouts,
+            const std::shared_ptr<GFXRenderPassLayout>& renderPass,
+            const GFXGraphicsPipelineState& gpInfo) override;
+
+        virtual void GCollect() override;
+
+        size_t GetCachedPipelineCount() const { return m_caches.size(); }
+    protected:
+        struct PipelineEntry
+        {
+            std::weak_ptr<GFXShaderPass> ShaderPass;
+            std::shared_ptr<GFXGraphicsPipeline> Pipeline;
+        };
+
+        GFXNullApplication* m_app;
+        std::mutex m_mutex;
+        std::unordered_map<GFXGraphicsPipelineKey, PipelineEntry, GFXGraphicsPipelineKeyHash> m_caches;
+    };
+}
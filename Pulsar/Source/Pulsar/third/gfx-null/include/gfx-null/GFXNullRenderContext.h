@@ -0,0 +1,38 @@
+#pragma once
+#include <gfx/GFXRenderContext.h>
+#include "GFXNullCommandBuffer.h"
+#include <deque>
+
+namespace gfx
+{
+    class GFXNullApplication;
+
+    class GFXNullRenderContext : public GFXRenderContext
+    {
+    public:
+        explicit GFXNullRenderContext(GFXNullApplication* app)
+            : m_app(app)
+        {
+        }
+    public:
+        virtual GFXApplication* GetApplication() override;
+
+        // command buffers are not movable, a deque keeps the references handed out valid
+        virtual GFXCommandBuffer& AddCommandBuffer() override
+        {
+            return m_buffers.emplace_back(m_app);
+        }
+        virtual GFXCommandBuffer& GetCommandBuffer(size_t index) override
+        {
+            return m_buffers[index];
+        }
+        virtual size_t GetCommandBufferCount() const override
+        {
+            return m_buffers.size();
+        }
+        virtual void Submit() override;
+    protected:
+        GFXNullApplication* m_app;
+        std::deque<GFXNullCommandBuffer> m_buffers;
+    };
+}
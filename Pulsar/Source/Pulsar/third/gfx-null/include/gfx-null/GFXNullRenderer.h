@@ -0,0 +1,24 @@
+#pragma once
+#include "GFXNullRenderContext.h"
+#include <gfx/GFXRenderer.h>
+
+namespace gfx
+{
+    class GFXNullApplication;
+
+    class GFXNullRenderer : public GFXRenderer
+    {
+    public:
+        explicit GFXNullRenderer(GFXNullApplication* app)
+            : m_app(app)
+        {
+        }
+    public:
+        void Render(float deltaTime);
+
+        virtual void WaitExecuteRender(const std::function<void(GFXRenderContext*)>& func) override;
+    protected:
+        GFXNullApplication* m_app;
+        uint32_t m_currentFrame = 0;
+    };
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <gfx/GFXGpuProgram.h>
+#include <gfx/GFXShaderPass.h>
+#include <unordered_map>
+
+namespace gfx
+{
+    // the byte code is kept for inspection, nothing is compiled
+    class GFXNullGpuProgram : public GFXGpuProgram
+    {
+    public:
+        explicit GFXNullGpuProgram(const std::unordered_map<GFXShaderStageFlags, array_list<char>>& codes)
+            : m_codes(codes)
+        {
+        }
+        const std::unordered_map<GFXShaderStageFlags, array_list<char>>& GetCodes() const { return m_codes; }
+    protected:
+        std::unordered_map<GFXShaderStageFlags, array_list<char>> m_codes;
+    };
+    GFX_DECL_SPTR(GFXNullGpuProgram);
+
+    class GFXNullShaderPass : public GFXShaderPass
+    {
+    public:
+        GFXNullShaderPass(const GFXShaderPassConfig& config, const GFXGpuProgram_sp& gpuProgram)
+            : m_passConfig(config), m_gpuProgram(gpuProgram)
+        {
+        }
+        virtual GFXShaderPassConfig GetStateConfig() const override { return m_passConfig; }
+        const GFXGpuProgram_sp& GetGpuProgram() const { return m_gpuProgram; }
+    protected:
+        GFXShaderPassConfig m_passConfig;
+        GFXGpuProgram_sp m_gpuProgram;
+    };
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <gfx/GFXCommandBuffer.h>
+#include <cstdint>
+
+namespace gfx
+{
+    // everything the null backend was asked to do since it was created
+    struct GFXNullStatistics
+    {
+        uint64_t FrameCount{};
+        uint64_t SubmittedCommandBufferCount{};
+        uint64_t CommandCount{};
+
+        // summed from the GFXCommandBufferStats of every submitted command buffer
+        uint64_t PipelineBindCount{};
+        uint64_t SkippedPipelineBindCount{};
+        uint64_t DescriptorSetBindCount{};
+        uint64_t SkippedDescriptorSetBindCount{};
+        uint64_t VertexBufferBindCount{};
+        uint64_t SkippedVertexBufferBindCount{};
+        uint64_t IndexBufferBindCount{};
+        uint64_t SkippedIndexBufferBindCount{};
+        uint64_t DrawCount{};
+
+        uint64_t BufferUploadCount{};
+        uint64_t BufferUploadSize{};
+        uint64_t DescriptorSetUpdateCount{};
+        uint64_t DynamicBufferAllocationCount{};
+        uint64_t DynamicBufferAllocationSize{};
+
+        uint64_t BufferAllocationCount{};
+        uint64_t TextureAllocationCount{};
+        uint64_t DescriptorSetAllocationCount{};
+        uint64_t PipelineCreateCount{};
+        // resources alive right now
+        uint64_t LiveAllocationCount{};
+        uint64_t LiveAllocationSize{};
+
+        void AddCommandBufferStats(const GFXCommandBufferStats& stats)
+        {
+            PipelineBindCount += stats.PipelineBindCount;
+            SkippedPipelineBindCount += stats.SkippedPipelineBindCount;
+            DescriptorSetBindCount += stats.DescriptorSetBindCount;
+            SkippedDescriptorSetBindCount += stats.SkippedDescriptorSetBindCount;
+            VertexBufferBindCount += stats.VertexBufferBindCount;
+            SkippedVertexBufferBindCount += stats.SkippedVertexBufferBindCount;
+            IndexBufferBindCount += stats.IndexBufferBindCount;
+            SkippedIndexBufferBindCount += stats.SkippedIndexBufferBindCount;
+            DrawCount += stats.DrawCount;
+        }
+    };
+}
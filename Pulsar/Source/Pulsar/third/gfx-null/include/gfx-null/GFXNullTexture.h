@@ -0,0 +1,59 @@
+#pragma once
+#include <gfx/GFXTexture.h>
+#include <map>
+
+namespace gfx
+{
+    class GFXNullApplication;
+    class GFXNullTexture;
+
+    class GFXNullTexture2DView : public GFXTexture2DView
+    {
+    public:
+        explicit GFXNullTexture2DView(GFXNullTexture* tex, uint32_t arrayIndex)
+            : m_tex(tex), m_arrayIndex(arrayIndex)
+        {}
+
+        int32_t GetWidth() const override;
+        int32_t GetHeight() const override;
+        bool IsWritable() const override;
+        bool IsReadable() const override { return true; }
+        GFXTextureFormat GetFormat() const override;
+        GFXTextureTargetType GetTargetType() const override;
+        GFXTexture* GetTexture() const override;
+        uint32_t GetBaseArrayIndex() const override { return m_arrayIndex; }
+
+    protected:
+        GFXNullTexture* m_tex;
+        uint32_t m_arrayIndex;
+    };
+    GFX_DECL_SPTR(GFXNullTexture2DView);
+
+    // keeps the description only, pixel data is counted and dropped
+    class GFXNullTexture : public GFXTexture
+    {
+        using base = GFXTexture;
+    public:
+        virtual const type_info& GetClassId() const override { return typeid(GFXNullTexture); }
+
+        GFXNullTexture(GFXNullApplication* app, const GFXTextureCreateInfo& info);
+        GFXNullTexture(const GFXNullTexture&) = delete;
+        virtual ~GFXNullTexture() override;
+    public:
+        virtual GFXTextureTargetType GetTargetType() const override { return m_targetType; }
+        virtual GFXTextureFormat GetFormat() const override { return m_format; }
+        virtual GFXTexture2DView_sp Get2DView(size_t index) override;
+
+        GFXTextureDataType GetDataType() const { return m_dataType; }
+        size_t GetAllocationSize() const { return m_allocationSize; }
+    protected:
+        GFXNullApplication* m_app;
+        GFXTextureFormat m_format;
+        GFXTextureDataType m_dataType;
+        GFXTextureTargetType m_targetType;
+        size_t m_allocationSize{};
+
+        std::map<size_t, GFXTexture2DView_sp> m_2dviews;
+    };
+    GFX_DECL_SPTR(GFXNullTexture);
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <gfx/GFXViewport.h>
+#include "GFXNullFrameBufferObject.h"
+#include "GFXNullTexture.h"
+#include <memory>
+
+namespace gfx
+{
+    class GFXNullApplication;
+
+    // stands in for the swap chain, a color and depth target of the configured window size
+    class GFXNullViewport : public GFXViewport
+    {
+    public:
+        GFXNullViewport(GFXNullApplication* app, int width, int height);
+        virtual ~GFXNullViewport() override;
+    public:
+        virtual GFXFrameBufferObject* GetFrameBufferObject() override { return m_framebuffer.get(); }
+        virtual void SetSize(int width, int height) override;
+        virtual void GetSize(int* width, int* height) const override;
+    protected:
+        void InitFrameBuffer();
+    protected:
+        GFXNullApplication* m_app;
+        int m_width;
+        int m_height;
+
+        std::shared_ptr<GFXNullTexture> m_colorTarget;
+        std::shared_ptr<GFXNullTexture> m_depthTarget;
+        std::unique_ptr<GFXNullFrameBufferObject> m_framebuffer;
+    };
+}
@@ -0,0 +1,289 @@
+#include "GFXNullApplication.h"
+#include "GFXNullBuffer.h"
+#include "GFXNullCommandBuffer.h"
+#include "GFXNullDescriptorManager.h"
+#include "GFXNullDescriptorSet.h"
+#include "GFXNullDynamicBuffer.h"
+#include "GFXNullFrameBufferObject.h"
+#include "GFXNullGraphicsPipeline.h"
+#include "GFXNullRenderer.h"
+#include "GFXNullShaderPass.h"
+#include "GFXNullTexture.h"
+#include "GFXNullViewport.h"
+
+namespace gfx
+{
+    static constexpr size_t kDynamicBufferFrameCapacity = 8 * 1024 * 1024;
+    static constexpr size_t kDynamicBufferMaxBindingRange = 64 * 1024;
+
+    void GFXNullApplication::Initialize()
+    {
+        m_viewport = new GFXNullViewport(this, m_config.WindowWidth, m_config.WindowHeight);
+        m_renderer = new GFXNullRenderer(this);
+        m_descriptorManager = new GFXNullDescriptorManager(this);
+        m_dynamicBuffer = new GFXNullDynamicBuffer(this, kDynamicBufferFrameCapacity, kDynamicBufferMaxBindingRange, kFramesInFlight);
+        m_graphicsPipelineManager = new GFXNullGraphicsPipelineManager(this);
+    }
+
+    void GFXNullApplication::ExecLoop()
+    {
+        uint64_t frame = 0;
+        while (!m_isAppEnding)
+        {
+            if (m_config.HeadlessFrameCount != 0 && frame >= m_config.HeadlessFrameCount)
+            {
+                break;
+            }
+            if (OnPreRender)
+            {
+                OnPreRender(kFixedDeltaTime);
+            }
+            TickRender(kFixedDeltaTime);
+            if (OnPostRender)
+            {
+                OnPostRender(kFixedDeltaTime);
+            }
+            ++frame;
+        }
+    }
+
+    void GFXNullApplication::RequestStop()
+    {
+        m_isAppEnding = true;
+    }
+
+    void GFXNullApplication::Terminate()
+    {
+        delete m_graphicsPipelineManager;
+        m_graphicsPipelineManager = nullptr;
+        delete m_dynamicBuffer;
+        m_dynamicBuffer = nullptr;
+        delete m_descriptorManager;
+        m_descriptorManager = nullptr;
+        delete m_renderer;
+        m_renderer = nullptr;
+        delete m_viewport;
+        m_viewport = nullptr;
+    }
+
+    void GFXNullApplication::TickRender(float deltaTime)
+    {
+        if (m_renderPipeline)
+        {
+            m_renderer->Render(deltaTime);
+        }
+        std::lock_guard lock{m_statisticsMutex};
+        ++m_statistics.FrameCount;
+    }
+
+    GFXRenderer* GFXNullApplication::GetRenderer()
+    {
+        return m_renderer;
+    }
+
+    GFXBuffer_sp GFXNullApplication::CreateBuffer(GFXBufferUsage usage, size_t bufferSize)
+    {
+        return gfxmksptr(new GFXNullBuffer(this, usage, bufferSize));
+    }
+
+    GFXCommandBuffer_sp GFXNullApplication::CreateCommandBuffer()
+    {
+        return gfxmksptr(new GFXNullCommandBuffer(this));
+    }
+
+    GFXVertexLayoutDescription_sp GFXNullApplication::CreateVertexLayoutDescription()
+    {
+        return gfxmksptr(new GFXVertexLayoutDescription);
+    }
+
+    GFXGpuProgram_sp GFXNullApplication::CreateGpuProgram(const std::unordered_map<gfx::GFXShaderStageFlags, array_list<char>>& codes)
+    {
+        return gfxmksptr(new GFXNullGpuProgram(codes));
+    }
+
+    GFXShaderPass_sp GFXNullApplication::CreateShaderPass(const GFXShaderPassConfig& config, const GFXGpuProgram_sp& gpuProgram)
+    {
+        return gfxmksptr(new GFXNullShaderPass(config, gpuProgram));
+    }
+
+    GFXDescriptorManager* GFXNullApplication::GetDescriptorManager()
+    {
+        return m_descriptorManager;
+    }
+
+    GFXDynamicBuffer* GFXNullApplication::GetDynamicBuffer()
+    {
+        return m_dynamicBuffer;
+    }
+
+    GFXMemoryStatistics GFXNullApplication::GetMemoryStatistics() const
+    {
+        std::lock_guard lock{m_statisticsMutex};
+        GFXMemoryStatistics memory{};
+        memory.BlockCount = m_statistics.LiveAllocationCount;
+        memory.AllocationCount = m_statistics.LiveAllocationCount;
+        memory.ReservedSize = m_statistics.LiveAllocationSize;
+        memory.UsedSize = m_statistics.LiveAllocationSize;
+        return memory;
+    }
+
+    GFXDescriptorSetLayout_sp GFXNullApplication::CreateDescriptorSetLayout(const GFXDescriptorSetLayoutInfo* layouts, size_t layoutCount)
+    {
+        return gfxmksptr(new GFXNullDescriptorSetLayout(layouts, layoutCount));
+    }
+
+    GFXGraphicsPipelineManager* GFXNullApplication::GetGraphicsPipelineManager() const
+    {
+        return m_graphicsPipelineManager;
+    }
+
+    GFXTexture_sp GFXNullApplication::CreateTexture2DFromMemory(
+        const uint8_t* imageData, size_t length,
+        int width, int height,
+        GFXTextureFormat format,
+        const GFXSamplerConfig& samplerConfig)
+    {
+        GFXTextureCreateInfo info{};
+        info.imageData = imageData;
+        info.dataLength = length;
+        info.width = width;
+        info.height = height;
+        info.format = format;
+        info.dataType = GFXTextureDataType::Texture2D;
+        info.samplerCfg = samplerConfig;
+        return gfxmksptr(new GFXNullTexture(this, info));
+    }
+
+    GFXTexture_sp GFXNullApplication::CreateTextureCube(int32_t size)
+    {
+        GFXTextureCreateInfo info{};
+        info.width = size;
+        info.height = size;
+        info.format = GFXTextureFormat::R8G8B8A8_UNorm;
+        info.dataType = GFXTextureDataType::TextureCube;
+        info.arrayLayers = 6;
+        return gfxmksptr(new GFXNullTexture(this, info));
+    }
+
+    GFXTexture_sp GFXNullApplication::CreateRenderTarget(
+        int32_t width, int32_t height, GFXTextureTargetType type,
+        GFXTextureFormat format, const GFXSamplerConfig& samplerCfg)
+    {
+        GFXTextureCreateInfo info{};
+        info.width = width;
+        info.height = height;
+        info.format = format;
+        info.dataType = GFXTextureDataType::Texture2D;
+        info.samplerCfg = samplerCfg;
+        info.targetType = type;
+        return gfxmksptr(new GFXNullTexture(this, info));
+    }
+
+    GFXFrameBufferObject_sp GFXNullApplication::CreateFrameBufferObject(
+        const array_list<GFXTexture2DView_sp>& renderTargets,
+        const GFXRenderPassLayout_sp& renderPassLayout)
+    {
+        return gfxmksptr(new GFXNullFrameBufferObject(renderTargets, renderPassLayout));
+    }
+
+    GFXRenderPassLayout_sp GFXNullApplication::CreateRenderPassLayout(const array_list<GFXTexture2DView*>& renderTargets)
+    {
+        return gfxmksptr(new GFXNullRenderPassLayout(renderTargets));
+    }
+
+    array_list<GFXTextureFormat> GFXNullApplication::GetSupportedDepthFormats()
+    {
+        return {GFXTextureFormat::D32_SFloat, GFXTextureFormat::D32_SFloat_S8_UInt, GFXTextureFormat::D24_UNorm_S8_UInt};
+    }
+
+    GFXViewport* GFXNullApplication::GetViewport()
+    {
+        return m_viewport;
+    }
+
+    GFXNullStatistics GFXNullApplication::GetStatistics() const
+    {
+        GFXNullStatistics statistics;
+        {
+            std::lock_guard lock{m_statisticsMutex};
+            statistics = m_statistics;
+        }
+        if (m_dynamicBuffer)
+        {
+            statistics.DynamicBufferAllocationCount = m_dynamicBuffer->GetAllocationCount();
+            statistics.DynamicBufferAllocationSize = m_dynamicBuffer->GetAllocationSize();
+        }
+        return statistics;
+    }
+
+    void GFXNullApplication::ResetStatistics()
+    {
+        std::lock_guard lock{m_statisticsMutex};
+        // live resources are still alive after a reset
+        const auto liveCount = m_statistics.LiveAllocationCount;
+        const auto liveSize = m_statistics.LiveAllocationSize;
+        m_statistics = {};
+        m_statistics.LiveAllocationCount = liveCount;
+        m_statistics.LiveAllocationSize = liveSize;
+        if (m_dynamicBuffer)
+        {
+            m_dynamicBuffer->ResetAllocationCount();
+        }
+    }
+
+    void GFXNullApplication::CountBufferAllocation(size_t size)
+    {
+        std::lock_guard lock{m_statisticsMutex};
+        ++m_statistics.BufferAllocationCount;
+        ++m_statistics.LiveAllocationCount;
+        m_statistics.LiveAllocationSize += size;
+    }
+
+    void GFXNullApplication::CountTextureAllocation(size_t size)
+    {
+        std::lock_guard lock{m_statisticsMutex};
+        ++m_statistics.TextureAllocationCount;
+        ++m_statistics.LiveAllocationCount;
+        m_statistics.LiveAllocationSize += size;
+    }
+
+    void GFXNullApplication::CountRelease(size_t size)
+    {
+        std::lock_guard lock{m_statisticsMutex};
+        --m_statistics.LiveAllocationCount;
+        m_statistics.LiveAllocationSize -= size;
+    }
+
+    void GFXNullApplication::CountBufferUpload(size_t size)
+    {
+        std::lock_guard lock{m_statisticsMutex};
+        ++m_statistics.BufferUploadCount;
+        m_statistics.BufferUploadSize += size;
+    }
+
+    void GFXNullApplication::CountDescriptorSetAllocation()
+    {
+        std::lock_guard lock{m_statisticsMutex};
+        ++m_statistics.DescriptorSetAllocationCount;
+    }
+
+    void GFXNullApplication::CountDescriptorSetUpdate()
+    {
+        std::lock_guard lock{m_statisticsMutex};
+        ++m_statistics.DescriptorSetUpdateCount;
+    }
+
+    void GFXNullApplication::CountPipelineCreate()
+    {
+        std::lock_guard lock{m_statisticsMutex};
+        ++m_statistics.PipelineCreateCount;
+    }
+
+    void GFXNullApplication::CountSubmit(const GFXNullCommandBuffer& cmdBuffer)
+    {
+        std::lock_guard lock{m_statisticsMutex};
+        ++m_statistics.SubmittedCommandBufferCount;
+        m_statistics.CommandCount += cmdBuffer.GetCommands().size();
+        m_statistics.AddCommandBufferStats(cmdBuffer.GetStats());
+    }
+}
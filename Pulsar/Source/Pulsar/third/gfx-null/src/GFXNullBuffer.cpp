@@ -0,0 +1,35 @@
+#include "GFXNullBuffer.h"
+#include "GFXNullApplication.h"
+#include <cstring>
+
+namespace gfx
+{
+    GFXNullBuffer::GFXNullBuffer(GFXNullApplication* app, GFXBufferUsage usage, size_t bufferSize)
+        : base(usage, bufferSize), m_app(app), m_data(bufferSize)
+    {
+        m_app->CountBufferAllocation(m_bufferSize);
+    }
+
+    GFXNullBuffer::~GFXNullBuffer()
+    {
+        Release();
+    }
+
+    void GFXNullBuffer::Fill(const void* data)
+    {
+        std::memcpy(m_data.data(), data, m_bufferSize);
+        m_app->CountBufferUpload(m_bufferSize);
+    }
+
+    void GFXNullBuffer::Release()
+    {
+        if (!m_isValid)
+        {
+            return;
+        }
+        m_isValid = false;
+        m_data.clear();
+        m_data.shrink_to_fit();
+        m_app->CountRelease(m_bufferSize);
+    }
+}
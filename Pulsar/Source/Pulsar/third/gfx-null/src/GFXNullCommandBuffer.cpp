@@ -0,0 +1,153 @@
+#include "GFXNullCommandBuffer.h"
+#include "GFXNullApplication.h"
+#include "GFXNullDescriptorSet.h"
+#include "GFXNullGraphicsPipeline.h"
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+namespace gfx
+{
+    static uint64_t _PackFloats(float a, float b)
+    {
+        uint32_t ua, ub;
+        std::memcpy(&ua, &a, sizeof(ua));
+        std::memcpy(&ub, &b, sizeof(ub));
+        return (static_cast<uint64_t>(ua) << 32) | ub;
+    }
+
+    void GFXNullCommandBuffer::Begin()
+    {
+        m_commands.clear();
+        m_bindState.Reset();
+        m_stats = {};
+        m_isRecorded = true;
+    }
+    void GFXNullCommandBuffer::End()
+    {
+    }
+
+    void GFXNullCommandBuffer::CmdBindGraphicsPipeline(GFXGraphicsPipeline* pipeline)
+    {
+        if (!m_bindState.BindPipeline(pipeline, m_stats))
+        {
+            return;
+        }
+        Record(GFXNullCommandType::BindGraphicsPipeline, pipeline);
+    }
+
+    void GFXNullCommandBuffer::CmdBindVertexBuffers(const std::vector<GFXBuffer*>& buffers)
+    {
+        const auto count = static_cast<uint32_t>(buffers.size());
+        if (!m_bindState.BindVertexBuffers(buffers.data(), count, m_stats))
+        {
+            return;
+        }
+        Record(GFXNullCommandType::BindVertexBuffers, count ? buffers[0] : nullptr, count);
+    }
+
+    void GFXNullCommandBuffer::CmdBindIndexBuffer(GFXBuffer* buffer)
+    {
+        const auto indexSize = buffer->GetElementSize();
+        if (!m_bindState.BindIndexBuffer(buffer, indexSize, m_stats))
+        {
+            return;
+        }
+        Record(GFXNullCommandType::BindIndexBuffer, buffer, indexSize);
+    }
+
+    void GFXNullCommandBuffer::CmdBindDescriptorSets(
+        const array_list<GFXDescriptorSet*>& descriptorSet, GFXGraphicsPipeline* pipeline,
+        const array_list<uint32_t>& dynamicOffsets)
+    {
+        assert(descriptorSet.size() <= BindState::kMaxDescriptorSets);
+        const auto count = static_cast<uint32_t>(descriptorSet.size());
+        const auto& pipelineLayouts = static_cast<GFXNullGraphicsPipeline*>(pipeline)->GetDescriptorSetLayouts();
+
+        BindState::DescriptorSets sets{};
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const auto nullDescSet = static_cast<GFXNullDescriptorSet*>(descriptorSet[i]);
+            const auto layout = nullDescSet->GetNullDescriptorSetLayout();
+
+            // vulkan requires the set to match the pipeline layout, catch it here where no validation layer runs
+            if (i >= pipelineLayouts.size() ||
+                (pipelineLayouts[i].get() != layout && pipelineLayouts[i]->GetLayoutInfos() != layout->GetLayoutInfos()))
+            {
+                throw std::runtime_error("descriptor set layout is not compatible with the pipeline layout");
+            }
+
+            auto& set = sets[i];
+            set.Set = nullDescSet;
+            set.Layout = layout;
+            set.DynamicOffsetCount = layout->GetDynamicDescriptorCount();
+        }
+
+        uint32_t firstChangedOffset = 0;
+        const auto firstChanged = m_bindState.BindDescriptorSets(sets, count, dynamicOffsets, firstChangedOffset, m_stats);
+        if (firstChanged == count)
+        {
+            return;
+        }
+        Record(GFXNullCommandType::BindDescriptorSets, descriptorSet[firstChanged], firstChanged, count - firstChanged);
+    }
+
+    void GFXNullCommandBuffer::CmdDraw(size_t vertexCount)
+    {
+        ++m_stats.DrawCount;
+        Record(GFXNullCommandType::Draw, nullptr, vertexCount, 1);
+    }
+
+    void GFXNullCommandBuffer::CmdDrawIndexed(size_t indicesCount, uint32_t instanceCount)
+    {
+        ++m_stats.DrawCount;
+        Record(GFXNullCommandType::DrawIndexed, m_bindState.GetIndexBuffer(), indicesCount, instanceCount);
+    }
+
+    void GFXNullCommandBuffer::CmdClearColor(GFXTexture* rt, float r, float g, float b, float a)
+    {
+        Record(GFXNullCommandType::ClearColor, rt, _PackFloats(r, g), _PackFloats(b, a));
+    }
+
+    void GFXNullCommandBuffer::CmdClearColor(GFXTexture* rt)
+    {
+        const auto& color = rt->TargetClearColor;
+        CmdClearColor(rt, color[0], color[1], color[2], color[3]);
+    }
+
+    void GFXNullCommandBuffer::CmdBeginFrameBuffer()
+    {
+        assert(m_fbo);
+        Record(GFXNullCommandType::BeginFrameBuffer, m_fbo);
+    }
+
+    void GFXNullCommandBuffer::CmdEndFrameBuffer()
+    {
+        Record(GFXNullCommandType::EndFrameBuffer, m_fbo);
+    }
+
+    void GFXNullCommandBuffer::CmdSetViewport(float x, float y, float width, float height)
+    {
+        Record(GFXNullCommandType::SetViewport, nullptr, _PackFloats(x, y), _PackFloats(width, height));
+    }
+
+    void GFXNullCommandBuffer::CmdSetCullMode(GFXCullMode mode)
+    {
+        Record(GFXNullCommandType::SetCullMode, nullptr, static_cast<uint64_t>(mode));
+    }
+
+    void GFXNullCommandBuffer::CmdBlit(GFXTextureView* src, GFXTextureView* dest)
+    {
+        Record(GFXNullCommandType::Blit, src, reinterpret_cast<uint64_t>(dest));
+    }
+
+    void GFXNullCommandBuffer::CmdImageTransitionBarrier(GFXTextureView* rt, GFXResourceLayout layout)
+    {
+        Record(GFXNullCommandType::ImageTransitionBarrier, rt, static_cast<uint64_t>(layout));
+    }
+
+    GFXApplication* GFXNullCommandBuffer::GetApplication() const
+    {
+        return m_app;
+    }
+}
@@ -0,0 +1,120 @@
+#include "GFXNullDescriptorSet.h"
+#include "GFXNullApplication.h"
+#include "GFXNullDescriptorManager.h"
+
+namespace gfx
+{
+    GFXNullDescriptorSetLayout::GFXNullDescriptorSetLayout(const GFXDescriptorSetLayoutInfo* layouts, size_t layoutCount)
+    {
+        m_layoutInfos.assign(layouts, layouts + layoutCount);
+        for (const auto& binding : m_layoutInfos)
+        {
+            if (binding.Type == GFXDescriptorType::DynamicConstantBuffer ||
+                binding.Type == GFXDescriptorType::DynamicStructuredBuffer)
+            {
+                ++m_dynamicDescriptorCount;
+            }
+        }
+    }
+
+    void GFXNullDescriptor::SetBuffer(GFXBuffer* buffer, size_t range)
+    {
+        m_buffer = buffer;
+        m_range = range;
+        IsDirty = true;
+    }
+    void GFXNullDescriptor::SetConstantBuffer(GFXBuffer* buffer)
+    {
+        SetBuffer(buffer, buffer->GetSize());
+    }
+    void GFXNullDescriptor::SetStructuredBuffer(GFXBuffer* buffer)
+    {
+        SetBuffer(buffer, buffer->GetSize());
+    }
+    void GFXNullDescriptor::SetDynamicConstantBuffer(GFXBuffer* buffer, size_t range)
+    {
+        SetBuffer(buffer, range);
+    }
+    void GFXNullDescriptor::SetDynamicStructuredBuffer(GFXBuffer* buffer, size_t range)
+    {
+        SetBuffer(buffer, range);
+    }
+    void GFXNullDescriptor::SetTextureSampler2D(GFXTexture2DView* texture)
+    {
+        m_textureView = texture;
+        m_texture = texture->GetTexture();
+        IsDirty = true;
+    }
+    void GFXNullDescriptor::SetTexture2D(GFXTexture* texture)
+    {
+        m_texture = texture;
+        m_textureView = nullptr;
+        IsDirty = true;
+    }
+
+    GFXNullDescriptorSet::GFXNullDescriptorSet(GFXNullApplication* app, const GFXDescriptorSetLayout_sp& layout)
+        : m_app(app), m_setlayout(layout)
+    {
+        m_app->CountDescriptorSetAllocation();
+    }
+
+    GFXNullDescriptorSet::~GFXNullDescriptorSet() = default;
+
+    GFXDescriptor* GFXNullDescriptorSet::AddDescriptor(std::string_view name, uint32_t bindingPoint)
+    {
+        auto descriptor = new GFXNullDescriptor{bindingPoint};
+        descriptor->name = name;
+        m_descriptors.push_back(std::unique_ptr<GFXNullDescriptor>{descriptor});
+        return descriptor;
+    }
+    GFXDescriptor* GFXNullDescriptorSet::GetDescriptorAt(int index)
+    {
+        if (index < 0 || static_cast<size_t>(index) >= m_descriptors.size())
+            return nullptr;
+        return m_descriptors[index].get();
+    }
+    int32_t GFXNullDescriptorSet::GetDescriptorCount() const
+    {
+        return static_cast<int32_t>(m_descriptors.size());
+    }
+    GFXDescriptor* GFXNullDescriptorSet::Find(std::string_view name)
+    {
+        for (auto& item : m_descriptors)
+        {
+            if (item->name == name)
+            {
+                return item.get();
+            }
+        }
+        return nullptr;
+    }
+    GFXDescriptor* GFXNullDescriptorSet::FindByBinding(uint32_t bindingPoint)
+    {
+        for (auto& item : m_descriptors)
+        {
+            if (item->GetBindingPoint() == bindingPoint)
+            {
+                return item.get();
+            }
+        }
+        return nullptr;
+    }
+    void GFXNullDescriptorSet::Submit()
+    {
+        bool anyDirty = false;
+        for (auto& item : m_descriptors)
+        {
+            anyDirty |= item->IsDirty;
+            item->IsDirty = false;
+        }
+        if (anyDirty)
+        {
+            m_app->CountDescriptorSetUpdate();
+        }
+    }
+
+    std::shared_ptr<GFXDescriptorSet> GFXNullDescriptorManager::GetDescriptorSet(GFXDescriptorSetLayout_sp layout)
+    {
+        return std::shared_ptr<GFXDescriptorSet>(new GFXNullDescriptorSet(m_app, layout));
+    }
+}
@@ -0,0 +1,59 @@
+#include "GFXNullDynamicBuffer.h"
+#include "GFXNullApplication.h"
+#include <cassert>
+#include <stdexcept>
+
+namespace gfx
+{
+    static size_t _AlignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    GFXNullDynamicBuffer::GFXNullDynamicBuffer(GFXNullApplication* app, size_t frameCapacity, size_t maxBindingRange, uint32_t frameCount)
+        : m_app(app), m_maxBindingRange(maxBindingRange), m_frameCount(frameCount)
+    {
+        m_frameCapacity = _AlignUp(frameCapacity, kAlignment);
+        CreateBuffer();
+    }
+
+    void GFXNullDynamicBuffer::CreateBuffer()
+    {
+        const auto bufferSize = m_frameCapacity * m_frameCount + m_maxBindingRange;
+        m_buffer = std::make_unique<GFXNullBuffer>(m_app, GFXBufferUsage::ConstantBuffer, bufferSize);
+    }
+
+    void GFXNullDynamicBuffer::Reserve(size_t allocationCount, size_t allocationSize)
+    {
+        const auto required = allocationCount * _AlignUp(allocationSize, kAlignment);
+        if (required <= m_frameCapacity)
+        {
+            return;
+        }
+        assert(m_frameUsedSize == 0);
+        m_frameCapacity = _AlignUp(std::max(required, m_frameCapacity * 2), kAlignment);
+        CreateBuffer();
+    }
+
+    GFXDynamicBufferAllocation GFXNullDynamicBuffer::Allocate(size_t size)
+    {
+        const auto alignedSize = _AlignUp(size, kAlignment);
+        const auto offset = m_frameUsedSize.fetch_add(alignedSize, std::memory_order_relaxed);
+        if (offset + size > m_frameCapacity)
+        {
+            throw std::runtime_error("dynamic buffer is out of frame memory, the frame was not reserved!");
+        }
+        m_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        m_allocationSize.fetch_add(size, std::memory_order_relaxed);
+
+        const auto bufferOffset = m_frameIndex * m_frameCapacity + offset;
+        return GFXDynamicBufferAllocation{m_buffer->GetData() + bufferOffset, static_cast<uint32_t>(bufferOffset), size};
+    }
+
+    void GFXNullDynamicBuffer::BeginFrame(uint32_t frameIndex)
+    {
+        assert(frameIndex < m_frameCount);
+        m_frameIndex = frameIndex;
+        m_frameUsedSize = 0;
+    }
+}
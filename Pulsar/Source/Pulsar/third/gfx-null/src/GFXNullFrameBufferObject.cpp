@@ -0,0 +1,24 @@
+#include "GFXNullFrameBufferObject.h"
+
+namespace gfx
+{
+    GFXNullRenderPassLayout::GFXNullRenderPassLayout(const array_list<GFXTexture2DView*>& renderTargets)
+    {
+        for (const auto& target : renderTargets)
+        {
+            m_formats.push_back(target->GetFormat());
+            m_compatibilityKey.push_back(uint64_t(target->GetFormat()) << 32 | uint64_t(target->GetTargetType()));
+        }
+    }
+
+    GFXNullFrameBufferObject::GFXNullFrameBufferObject(
+        const array_list<GFXTexture2DView_sp>& renderTargets, const GFXRenderPassLayout_sp& renderPass)
+        : m_renderTargets(renderTargets), m_renderPass(renderPass)
+    {
+        if (!m_renderTargets.empty())
+        {
+            m_width = m_renderTargets[0]->GetWidth();
+            m_height = m_renderTargets[0]->GetHeight();
+        }
+    }
+}
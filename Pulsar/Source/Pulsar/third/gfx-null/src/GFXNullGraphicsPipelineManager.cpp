@@ -0,0 +1,31 @@
+#include "GFXNullGraphicsPipeline.h"
+#include "GFXNullApplication.h"
+
+namespace gfx
+{
+    std::shared_ptr<GFXGraphicsPipeline> GFXNullGraphicsPipelineManager::GetGraphicsPipeline(
+        const std::shared_ptr<GFXShaderPass>& shaderPass,
+        const array_list<GFXDescriptorSetLayout_sp>& descriptorSetLayouts,
+        const std::shared_ptr<GFXRenderPassLayout>& renderPass,
+        const GFXGraphicsPipelineState& gpInfo)
+    {
+        const auto key = GFXGraphicsPipelineKey::Make(shaderPass.get(), descriptorSetLayouts, *renderPass, gpInfo);
+
+        std::lock_guard lock{m_mutex};
+        auto& entry = m_caches[key];
+        if (entry.Pipeline && entry.ShaderPass.lock() == shaderPass)
+        {
+            return entry.Pipeline;
+        }
+        entry.ShaderPass = shaderPass;
+        entry.Pipeline = gfxmksptr(new GFXNullGraphicsPipeline(shaderPass, descriptorSetLayouts, gpInfo));
+        m_app->CountPipelineCreate();
+        return entry.Pipeline;
+    }
+
+    void GFXNullGraphicsPipelineManager::GCollect()
+    {
+        std::lock_guard lock{m_mutex};
+        std::erase_if(m_caches, [](const auto& item) { return item.second.ShaderPass.expired(); });
+    }
+}
@@ -0,0 +1,44 @@
+#include "GFXNullRenderer.h"
+#include "GFXNullApplication.h"
+#include "GFXNullDynamicBuffer.h"
+
+namespace gfx
+{
+    GFXApplication* GFXNullRenderContext::GetApplication()
+    {
+        return m_app;
+    }
+
+    void GFXNullRenderContext::Submit()
+    {
+        for (const auto& buffer : m_buffers)
+        {
+            // buffers added but never recorded are skipped, same as on vulkan
+            if (buffer.IsRecorded())
+            {
+                m_app->CountSubmit(buffer);
+            }
+        }
+    }
+
+    void GFXNullRenderer::Render(float deltaTime)
+    {
+        m_currentFrame = (m_currentFrame + 1) % GFXNullApplication::kFramesInFlight;
+        m_app->GetNullDynamicBuffer()->BeginFrame(m_currentFrame);
+
+        GFXNullRenderContext renderContext(m_app);
+        renderContext.DeltaTime = deltaTime;
+
+        m_app->GetRenderPipeline()->OnRender(&renderContext, m_app->GetViewport()->GetFrameBufferObject());
+
+        renderContext.Submit();
+        m_app->GetGraphicsPipelineManager()->GCollect();
+    }
+
+    void GFXNullRenderer::WaitExecuteRender(const std::function<void(GFXRenderContext*)>& func)
+    {
+        GFXNullRenderContext renderContext(m_app);
+        func(&renderContext);
+        renderContext.Submit();
+    }
+}
@@ -0,0 +1,89 @@
+#include "GFXNullTexture.h"
+#include "GFXNullApplication.h"
+#include <cassert>
+
+namespace gfx
+{
+    static size_t _GetBytesPerPixel(GFXTextureFormat format)
+    {
+        switch (format)
+        {
+        case GFXTextureFormat::R8_UNorm:
+            return 1;
+        case GFXTextureFormat::R8G8B8A8_UNorm:
+        case GFXTextureFormat::R8G8B8A8_SRGB:
+        case GFXTextureFormat::B10G11R11_UFloat:
+        case GFXTextureFormat::D32_SFloat:
+        case GFXTextureFormat::D24_UNorm_S8_UInt:
+            return 4;
+        case GFXTextureFormat::R16G16B16A16_SFloat:
+        case GFXTextureFormat::D32_SFloat_S8_UInt:
+            return 8;
+        case GFXTextureFormat::R32G32B32A32_SFloat:
+            return 16;
+        // 16 bytes per 4x4 block
+        case GFXTextureFormat::BC3_SRGB:
+        case GFXTextureFormat::BC5_UNorm:
+        case GFXTextureFormat::BC6H_RGB_SFloat:
+            return 1;
+        }
+        return 4;
+    }
+
+    GFXNullTexture::GFXNullTexture(GFXNullApplication* app, const GFXTextureCreateInfo& info)
+        : base(info.width, info.height, info.depth, info.samplerCfg),
+          m_app(app), m_format(info.format), m_dataType(info.dataType), m_targetType(info.targetType)
+    {
+        m_mipLevels = info.mipLevels;
+        m_arrayLayers = info.arrayLayers;
+
+        m_allocationSize = static_cast<size_t>(m_width) * m_height * m_depth * m_arrayLayers * _GetBytesPerPixel(m_format);
+        m_app->CountTextureAllocation(m_allocationSize);
+        if (info.imageData)
+        {
+            m_app->CountBufferUpload(info.dataLength);
+        }
+    }
+
+    GFXNullTexture::~GFXNullTexture()
+    {
+        m_2dviews.clear();
+        m_app->CountRelease(m_allocationSize);
+    }
+
+    GFXTexture2DView_sp GFXNullTexture::Get2DView(size_t index)
+    {
+        assert(m_dataType != GFXTextureDataType::None);
+        auto& view = m_2dviews[index];
+        if (!view)
+        {
+            view = gfxmksptr(new GFXNullTexture2DView(this, static_cast<uint32_t>(index)));
+        }
+        return view;
+    }
+
+    int32_t GFXNullTexture2DView::GetWidth() const
+    {
+        return m_tex->GetWidth();
+    }
+    int32_t GFXNullTexture2DView::GetHeight() const
+    {
+        return m_tex->GetHeight();
+    }
+    bool GFXNullTexture2DView::IsWritable() const
+    {
+        return m_tex->GetTargetType() != GFXTextureTargetType::None;
+    }
+    GFXTextureFormat GFXNullTexture2DView::GetFormat() const
+    {
+        return m_tex->GetFormat();
+    }
+    GFXTextureTargetType GFXNullTexture2DView::GetTargetType() const
+    {
+        return m_tex->GetTargetType();
+    }
+    GFXTexture* GFXNullTexture2DView::GetTexture() const
+    {
+        return m_tex;
+    }
+}
@@ -0,0 +1,57 @@
+#include "GFXNullViewport.h"
+#include "GFXNullApplication.h"
+
+namespace gfx
+{
+    GFXNullViewport::GFXNullViewport(GFXNullApplication* app, int width, int height)
+        : m_app(app), m_width(width), m_height(height)
+    {
+        InitFrameBuffer();
+    }
+
+    GFXNullViewport::~GFXNullViewport()
+    {
+        m_framebuffer.reset();
+        m_colorTarget.reset();
+        m_depthTarget.reset();
+    }
+
+    void GFXNullViewport::InitFrameBuffer()
+    {
+        m_framebuffer.reset();
+
+        GFXTextureCreateInfo info{};
+        info.width = m_width;
+        info.height = m_height;
+        info.dataType = GFXTextureDataType::Texture2D;
+
+        info.format = GFXTextureFormat::R8G8B8A8_UNorm;
+        info.targetType = GFXTextureTargetType::ColorTarget;
+        m_colorTarget = std::make_shared<GFXNullTexture>(m_app, info);
+
+        info.format = GFXTextureFormat::D32_SFloat;
+        info.targetType = GFXTextureTargetType::DepthTarget;
+        m_depthTarget = std::make_shared<GFXNullTexture>(m_app, info);
+
+        array_list<GFXTexture2DView_sp> targets{m_colorTarget->Get2DView(0), m_depthTarget->Get2DView(0)};
+        auto renderPass = gfxmksptr(new GFXNullRenderPassLayout({targets[0].get(), targets[1].get()}));
+        m_framebuffer = std::make_unique<GFXNullFrameBufferObject>(targets, renderPass);
+    }
+
+    void GFXNullViewport::SetSize(int width, int height)
+    {
+        if (m_width == width && m_height == height)
+        {
+            return;
+        }
+        m_width = width;
+        m_height = height;
+        InitFrameBuffer();
+    }
+
+    void GFXNullViewport::GetSize(int* width, int* height) const
+    {
+        *width = m_width;
+        *height = m_height;
+    }
+}
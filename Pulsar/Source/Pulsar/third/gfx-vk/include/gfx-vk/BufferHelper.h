@@ -1,5 +1,6 @@
 #pragma once
 #include "GFXVulkanApplication.h"
+#include "GFXVulkanMemoryAllocator.h"
 #include <vector>
 
 namespace gfx
@@ -15,11 +16,11 @@ namespace gfx
             VkBufferUsageFlags usage,
             VkMemoryPropertyFlags properties,
             VkBuffer& buffer,
-            VkDeviceMemory& bufferMemory);
+            GFXVulkanMemoryAllocation& bufferMemory);
 
         static void TransferBuffer(GFXVulkanApplication* app, VkBuffer src, VkBuffer dest, VkDeviceSize size);
 
-        static void DestroyBuffer(GFXVulkanApplication* app, VkBuffer buffer, VkDeviceMemory mem);
+        static void DestroyBuffer(GFXVulkanApplication* app, VkBuffer buffer, GFXVulkanMemoryAllocation& mem);
 
         static void TransitionImageLayout(
             GFXVulkanApplication* app,
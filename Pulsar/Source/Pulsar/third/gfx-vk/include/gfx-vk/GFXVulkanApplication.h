@@ -13,6 +13,7 @@
 #include "GFXVulkanViewport.h"
 #include "gfx/GFXTextureView.h"
 #include <chrono>
+#include <functional>
 
 namespace gfx
 {
@@ -81,6 +82,14 @@ namespace gfx
         virtual array_list<GFXTextureFormat> GetSupportedDepthFormats() override;
 
         class GFXVulkanDescriptorManager* GetVulkanDescriptorManager() const { return m_descriptorManager; }
+        virtual GFXDynamicBuffer* GetDynamicBuffer() override;
+        class GFXVulkanDynamicBuffer* GetVulkanDynamicBuffer() const { return m_dynamicBuffer; }
+        class GFXVulkanMemoryAllocator* GetMemoryAllocator() const { return m_memoryAllocator; }
+        class GFXVulkanUploadManager* GetUploadManager() const { return m_uploadManager; }
+        class GFXVulkanFrameResources* GetFrameResources() const { return m_frameResources; }
+        // destroys the resource once the frames in flight that may use it have retired
+        void DeferDestroy(std::function<void()>&& destroyer);
+        virtual GFXMemoryStatistics GetMemoryStatistics() const override;
         virtual GFXExtensions GetExtensionNames() override;
         virtual intptr_t GetWindowHandle() override;
 
@@ -88,6 +97,7 @@ namespace gfx
     public:
         const VkDevice& GetVkDevice() const { return m_device; }
         const VkPhysicalDevice& GetVkPhysicalDevice() const { return m_physicalDevice; }
+        const VkPhysicalDeviceProperties& GetVkPhysicalDeviceProperties() const { return m_physicalDeviceProperties; }
         const VkInstance& GetVkInstance() const { return m_instance; }
         const VkSurfaceKHR& GetVkSurface() const { return m_surface; }
         const VkQueue& GetVkGraphicsQueue() const { return m_graphicsQueue; }
@@ -130,6 +140,7 @@ namespace gfx
         //VkCommandPool m_commandPool = VK_NULL_HANDLE;
 
         VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
+        VkPhysicalDeviceProperties m_physicalDeviceProperties{};
         VkDevice m_device = VK_NULL_HANDLE;
 
         GFXVulkanViewport* m_viewport = nullptr;
@@ -140,6 +151,10 @@ namespace gfx
         VkQueue m_presentQueue = VK_NULL_HANDLE;
 
         class GFXVulkanDescriptorManager* m_descriptorManager = nullptr;
+        class GFXVulkanDynamicBuffer* m_dynamicBuffer = nullptr;
+        class GFXVulkanMemoryAllocator* m_memoryAllocator = nullptr;
+        class GFXVulkanUploadManager* m_uploadManager = nullptr;
+        class GFXVulkanFrameResources* m_frameResources = nullptr;
         class GFXVulkanRenderer* m_renderer = nullptr;
 
         class GFXVulkanCommandBufferPool* m_cmdPool = nullptr;
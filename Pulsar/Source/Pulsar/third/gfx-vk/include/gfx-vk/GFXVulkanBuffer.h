@@ -1,6 +1,8 @@
 #pragma once
 #include <gfx/GFXBuffer.h>
 #include <vulkan/vulkan.h>
+#include "GFXVulkanMemoryAllocator.h"
+#include <vector>
 
 namespace gfx
 {
@@ -10,7 +12,9 @@ namespace gfx
     {
         using base = GFXBuffer;
     public:
-        GFXVulkanBuffer(GFXVulkanApplication* app, GFXBufferUsage usage, size_t bufferSize);
+        // host visible buffers with frameCount > 1 keep one copy per frame in flight
+        GFXVulkanBuffer(GFXVulkanApplication* app, GFXBufferUsage usage, size_t bufferSize,
+            VkBufferUsageFlags extraUsage = 0, uint32_t frameCount = 1);
         virtual ~GFXVulkanBuffer() override;
     public:
         virtual void Fill(const void* data) override;
@@ -18,17 +22,34 @@ namespace gfx
         const VkBuffer& GetVkBuffer() const { return m_vkBuffer; }
         VkBufferUsageFlags GetVkUsage() const;
         bool IsGpuLocalMemory() const;
+        // host visible memory is mapped for the buffer lifetime
+        void* Map();
+        // device local data is copied asynchronously, it is visible to any later submission on the graphics queue
+        bool IsUploadRetired() const;
+        void WaitUpload();
+
+        uint32_t GetFrameCount() const { return m_frameCount; }
+        VkDeviceSize GetFrameOffset(uint32_t frameIndex) const { return m_frameCount > 1 ? frameIndex * m_frameStride : 0; }
+        // copies the latest data into the copy of the frame, returns true when every copy is up to date
+        bool UpdateFrame(uint32_t frameIndex);
         GFXVulkanApplication* GetApplication() const { return m_app; }
     public:
         /* GFXBuffer */
         virtual bool IsValid() const override;
         virtual size_t GetSize() const override { return this->m_bufferSize; }
-    public:
-
+    protected:
+        void DestroyVkBuffer();
     protected:
         bool m_hasData = true;
         VkBuffer m_vkBuffer{};
-        VkDeviceMemory m_vkBufferMemory{};
+        GFXVulkanMemoryAllocation m_vkBufferMemory{};
+        VkBufferUsageFlags m_extraUsage{};
+        uint64_t m_uploadId{};
+
+        uint32_t m_frameCount = 1;
+        VkDeviceSize m_frameStride{};
+        uint32_t m_staleFrameMask{};
+        std::vector<uint8_t> m_frameShadow;
         GFXVulkanApplication* m_app = nullptr;
     };
 }
\ No newline at end of file
@@ -1,10 +1,12 @@
 #pragma once
+#include <gfx/GFXCommandBindState.h>
 #include <gfx/GFXCommandBuffer.h>
 #include "VulkanInclude.h"
 #include "GFXVulkanFrameBufferObject.h"
 #include "GFXVulkanBuffer.h"
 #include "GFXVulkanDescriptorSet.h"
 #include "GFXVulkanShaderPass.h"
+#include <algorithm>
 #include <array>
 
 namespace gfx
@@ -27,9 +29,11 @@ namespace gfx
         virtual void CmdBindGraphicsPipeline(GFXGraphicsPipeline* pipeline) override;
         virtual void CmdBindVertexBuffers(const std::vector<GFXBuffer*>& buffers) override;
         virtual void CmdBindIndexBuffer(GFXBuffer* buffer) override;
-        virtual void CmdBindDescriptorSets(const array_list<GFXDescriptorSet*>& descriptorSet, GFXGraphicsPipeline* pipeline) override;
+        virtual void CmdBindDescriptorSets(
+            const array_list<GFXDescriptorSet*>& descriptorSet, GFXGraphicsPipeline* pipeline,
+            const array_list<uint32_t>& dynamicOffsets = {}) override;
         virtual void CmdDraw(size_t vertexCount) override;
-        virtual void CmdDrawIndexed(size_t indicesCount) override;
+        virtual void CmdDrawIndexed(size_t indicesCount, uint32_t instanceCount = 1) override;
         virtual void CmdClearColor(GFXTexture* rt, float r, float g, float b, float a) override;
         virtual void CmdClearColor(GFXTexture* rt) override;
 
@@ -41,11 +45,19 @@ namespace gfx
         virtual void CmdImageTransitionBarrier(GFXTextureView* rt, GFXResourceLayout layout) override;
     public:
         virtual GFXApplication* GetApplication() const override;
+        virtual const GFXCommandBufferStats& GetStats() const override { return m_stats; }
         const VkCommandBuffer& GetVkCommandBuffer() const { return m_cmdBuffer; }
+
+        // call after recording raw vk commands that may change bindings
+        void ResetBindState() { m_bindState.Reset(); }
     protected:
+        using BindState = GFXCommandBindState<VkPipeline, VkBuffer, VkDescriptorSet, VkDescriptorSetLayout>;
+
         VkCommandBuffer m_cmdBuffer = VK_NULL_HANDLE;
         GFXVulkanApplication* m_app;
         GFXVulkanFrameBufferObject* m_fbo = nullptr;
+        BindState m_bindState{};
+        GFXCommandBufferStats m_stats{};
     public:
 
     };
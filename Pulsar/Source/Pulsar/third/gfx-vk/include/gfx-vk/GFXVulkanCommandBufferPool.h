@@ -1,12 +1,17 @@
 #pragma once
 #include "VulkanInclude.h"
-#include <vector>
+#include <memory>
+#include <mutex>
 #include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace gfx
 {
     class GFXVulkanApplication;
 
+    // one VkCommandPool per recording thread, command pools can not be used by two threads at once.
     class GFXVulkanCommandBufferPool
     {
     public:
@@ -14,17 +19,27 @@ namespace gfx
         ~GFXVulkanCommandBufferPool();
 
     public:
+        // allocates from the pool of the calling thread
         VkCommandBuffer GetVkCommandBuffer();
-    public:
-        const VkCommandPool& GetVkCommandPool() const { return m_pool; }
-
+        // can be called from any thread, the buffer is reset by its own thread on the next GetVkCommandBuffer
         void ReleaseCommandBuffer(VkCommandBuffer buffer);
     private:
-        void AllocCommandBuffer();
+        struct ThreadPool
+        {
+            VkCommandPool Pool = VK_NULL_HANDLE;
+            std::queue<VkCommandBuffer> Initial;
+            std::mutex ReleasedMutex;
+            std::vector<VkCommandBuffer> Released;
+        };
+
+        ThreadPool* GetThreadPool();
+        void AllocCommandBuffer(ThreadPool* threadPool);
     protected:
         GFXVulkanApplication* m_app;
-        VkCommandPool m_pool;
+        uint32_t m_queueFamilyIndex{};
 
-        std::queue<VkCommandBuffer> m_initial;
+        std::mutex m_mutex;
+        std::unordered_map<std::thread::id, std::unique_ptr<ThreadPool>> m_threadPools;
+        std::unordered_map<VkCommandBuffer, ThreadPool*> m_owners;
     };
-}
\ No newline at end of file
+}
@@ -13,7 +13,8 @@ namespace gfx
         ~GFXVulkanDescriptorPool();
     public:
         std::shared_ptr<GFXVulkanDescriptorSet> GetDescriptorSet(const GFXDescriptorSetLayout_sp& layout);
-        void ReleaseDescriptorSet();
+        // counts vulkan sets, a descriptor set allocates one per frame in flight
+        void ReleaseDescriptorSet(size_t setCount);
     public:
         const VkDescriptorPool& GetVkDescriptorPool() const { return m_descriptorPool; }
         GFXVulkanApplication* GetApplication() const { return m_app; }
@@ -1,6 +1,7 @@
 #pragma once
 #include <gfx/GFXDescriptorSet.h>
 #include "VulkanInclude.h"
+#include <vector>
 
 namespace gfx
 {
@@ -21,9 +22,11 @@ namespace gfx
 
     public:
         const VkDescriptorSetLayout& GetVkDescriptorSetLayout() const { return m_descriptorSetLayout; }
+        // number of dynamic offsets a set of this layout takes when bound
+        uint32_t GetDynamicDescriptorCount() const { return m_dynamicDescriptorCount; }
 
     protected:
-        array_list<GFXDescriptorSetLayoutInfo> m_debugInfo;
+        uint32_t m_dynamicDescriptorCount{};
         VkDescriptorSetLayout m_descriptorSetLayout;
         GFXVulkanApplication* m_app;
     };
@@ -42,6 +45,8 @@ namespace gfx
         virtual void SetTextureSampler2D(GFXTexture2DView* texture) override;
         virtual void SetTexture2D(GFXTexture* texture) override;
         virtual void SetStructuredBuffer(GFXBuffer* buffer) override;
+        virtual void SetDynamicConstantBuffer(GFXBuffer* buffer, size_t range) override;
+        virtual void SetDynamicStructuredBuffer(GFXBuffer* buffer, size_t range) override;
 
         uint32_t GetBindingPoint() const
         {
@@ -50,6 +55,9 @@ namespace gfx
         VkDescriptorBufferInfo BufferInfo{};
         VkDescriptorImageInfo ImageInfo{};
         VkWriteDescriptorSet WriteInfo{};
+        // buffers with one copy per frame are bound at the offset of the set's frame
+        VkDeviceSize BufferFrameStride{};
+        uint32_t StaleFrameMask{};
     protected:
         GFXVulkanDescriptorSet* m_descriptorSet;
         uint32_t m_bindingPoint;
@@ -61,7 +69,7 @@ namespace gfx
         using base = GFXDescriptorSet;
         friend class GFXVulkanDescriptorPool;
     private:
-        GFXVulkanDescriptorSet(GFXVulkanDescriptorPool* pool, const GFXDescriptorSetLayout_sp& layout);
+        GFXVulkanDescriptorSet(GFXVulkanDescriptorPool* pool, const GFXDescriptorSetLayout_sp& layout, uint32_t frameCount);
     public:
         virtual ~GFXVulkanDescriptorSet() override;
         GFXVulkanDescriptorSet(const GFXVulkanDescriptorSet&) = delete;
@@ -75,13 +83,18 @@ namespace gfx
         virtual intptr_t GetId() override;
     public:
         GFXVulkanApplication* GetApplication() const;
-        const VkDescriptorSet& GetVkDescriptorSet() const { return m_descriptorSet; }
+        // the set of the frame being recorded
+        VkDescriptorSet GetVkDescriptorSet() const;
+        VkDescriptorSet GetVkDescriptorSet(uint32_t frameIndex) const { return m_descriptorSets[frameIndex]; }
+        uint32_t GetFrameCount() const { return static_cast<uint32_t>(m_descriptorSets.size()); }
+        // writes pending descriptors into the set of the frame, returns true when every set is up to date
+        bool UpdateFrame(uint32_t frameIndex);
         GFXVulkanDescriptorSetLayout_sp GetVkDescriptorSetLayout() const { return m_setlayout; }
         virtual GFXDescriptorSetLayout_sp GetDescriptorSetLayout() const override;
     protected:
         GFXVulkanDescriptorPool* m_pool;
         std::vector<std::unique_ptr<GFXVulkanDescriptor>> m_descriptors;
-        VkDescriptorSet m_descriptorSet = VK_NULL_HANDLE;
+        std::vector<VkDescriptorSet> m_descriptorSets;
         GFXVulkanDescriptorSetLayout_sp m_setlayout;
     };
     GFX_DECL_SPTR(GFXVulkanDescriptorSet);
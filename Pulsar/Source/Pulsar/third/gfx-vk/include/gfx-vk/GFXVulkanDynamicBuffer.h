@@ -0,0 +1,44 @@
+#pragma once
+#include <gfx/GFXDynamicBuffer.h>
+#include "GFXVulkanBuffer.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace gfx
+{
+    class GFXVulkanApplication;
+
+    class GFXVulkanDynamicBuffer : public GFXDynamicBuffer
+    {
+    public:
+        GFXVulkanDynamicBuffer(GFXVulkanApplication* app, size_t frameCapacity, size_t maxBindingRange, uint32_t frameCount);
+        virtual ~GFXVulkanDynamicBuffer() override;
+    public:
+        // thread safe
+        virtual GFXDynamicBufferAllocation Allocate(size_t size) override;
+        virtual void Reserve(size_t allocationCount, size_t allocationSize) override;
+
+        virtual GFXBuffer* GetBuffer() const override { return m_buffer.get(); }
+        virtual size_t GetMaxBindingRange() const override { return m_maxBindingRange; }
+        virtual size_t GetFrameCapacity() const override { return m_frameCapacity; }
+        virtual size_t GetFrameUsedSize() const override { return std::min(m_frameUsedSize.load(), m_frameCapacity); }
+
+        // switch to the slot of the frame, the caller must make sure the gpu finished reading it
+        void BeginFrame(uint32_t frameIndex);
+    protected:
+        void CreateBuffer();
+    protected:
+        GFXVulkanApplication* m_app;
+        std::unique_ptr<GFXVulkanBuffer> m_buffer;
+        uint8_t* m_mappedData = nullptr;
+
+        size_t m_alignment{};
+        size_t m_frameCapacity{};
+        size_t m_maxBindingRange{};
+        uint32_t m_frameCount{};
+
+        uint32_t m_frameIndex{};
+        std::atomic<size_t> m_frameUsedSize{};
+    };
+}
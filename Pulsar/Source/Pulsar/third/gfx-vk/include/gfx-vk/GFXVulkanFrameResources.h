@@ -0,0 +1,54 @@
+#pragma once
+#include "VulkanInclude.h"
+#include <functional>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace gfx
+{
+    class GFXVulkanBuffer;
+    class GFXVulkanDescriptorSet;
+
+    // bookkeeping for frames in flight. resources released by the cpu are destroyed once the frame slot
+    // comes around again, buffers and descriptor sets changed while the gpu may still read them
+    // keep one copy per slot and are brought up to date when their slot begins.
+    class GFXVulkanFrameResources
+    {
+    public:
+        explicit GFXVulkanFrameResources(uint32_t frameCount);
+        GFXVulkanFrameResources(const GFXVulkanFrameResources&) = delete;
+        ~GFXVulkanFrameResources();
+    public:
+        // the fence of the slot must have signaled
+        void BeginFrame(uint32_t frameIndex);
+        // the frame has been submitted, changes from now on can not touch the current slot
+        void EndFrame();
+
+        uint32_t GetFrameCount() const { return m_frameCount; }
+        uint32_t GetFrameIndex() const { return m_frameIndex; }
+        uint32_t GetAllFramesMask() const { return (1u << m_frameCount) - 1; }
+        bool IsRecording() const { return m_isRecording; }
+
+        // runs once no frame recorded so far can use the resource, thread safe
+        void DeferDestroy(std::function<void()>&& destroyer);
+        // runs every pending destroyer, the device must be idle
+        void FlushDeferred();
+
+        void AddStale(GFXVulkanBuffer* buffer) { m_staleBuffers.insert(buffer); }
+        void RemoveStale(GFXVulkanBuffer* buffer) { m_staleBuffers.erase(buffer); }
+        void AddStale(GFXVulkanDescriptorSet* descriptorSet) { m_staleDescriptorSets.insert(descriptorSet); }
+        void RemoveStale(GFXVulkanDescriptorSet* descriptorSet) { m_staleDescriptorSets.erase(descriptorSet); }
+    private:
+        static void RunDestroyers(std::vector<std::function<void()>>& destroyers);
+    private:
+        uint32_t m_frameCount;
+        uint32_t m_frameIndex{};
+        bool m_isRecording = false;
+
+        std::mutex m_deferredMutex;
+        std::vector<std::vector<std::function<void()>>> m_deferred;
+        std::unordered_set<GFXVulkanBuffer*> m_staleBuffers;
+        std::unordered_set<GFXVulkanDescriptorSet*> m_staleDescriptorSets;
+    };
+}
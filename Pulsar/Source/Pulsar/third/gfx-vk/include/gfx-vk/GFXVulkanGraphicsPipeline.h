@@ -17,7 +17,8 @@ namespace gfx
             const std::shared_ptr<GFXShaderPass>& shaderPass,
             const array_list<GFXDescriptorSetLayout_sp>& descriptorSetLayouts,
             const GFXRenderPassLayout& renderLayout,
-            const GFXGraphicsPipelineState& gpInfo);
+            const GFXGraphicsPipelineState& gpInfo,
+            VkPipelineCache pipelineCache = VK_NULL_HANDLE);
 
         virtual ~GFXVulkanGraphicsPipeline() override;
 
@@ -1,26 +1,59 @@
 #pragma once
+#include <gfx/GFXGraphicsPipelineKey.h>
 #include <gfx/GFXGraphicsPipelineManager.h>
+#include "VulkanInclude.h"
+#include <mutex>
 #include <unordered_map>
 
 namespace gfx
 {
     class GFXVulkanApplication;
+
+    // pipelines are keyed on everything they are built from. render passes, descriptor set layouts and
+    // vertex layouts are compared by content, so identically defined objects share pipelines.
+    // compiled pipelines go through a VkPipelineCache that is saved to GFXGlobalConfig::PipelineCachePath.
     class GFXVulkanGraphicsPipelineManager : public GFXGraphicsPipelineManager
     {
     public:
         GFXVulkanGraphicsPipelineManager(GFXVulkanApplication* app);
         virtual ~GFXVulkanGraphicsPipelineManager() override;
     public:
+        // thread safe
         virtual std::shared_ptr<GFXGraphicsPipeline> GetGraphicsPipeline(
             const std::shared_ptr<GFXShaderPass>& shaderPass,
             const array_list<GFXDescriptorSetLayout_sp>& descriptorSetLayouts,
             const std::shared_ptr<GFXRenderPassLayout>& renderPass,
             const GFXGraphicsPipelineState& gpInfo) override;
 
+        // call once per frame, drops pipelines of destroyed shader passes and evicts
+        // the least recently used ones while more than kMaxCachedPipelines are kept
         virtual void GCollect() override;
 
+        void SavePipelineCache();
+
+        size_t GetCachedPipelineCount() const { return m_caches.size(); }
+
+        static constexpr size_t kMaxCachedPipelines = 1024;
+        // pipelines used within this many frames are never evicted
+        static constexpr uint64_t kMinUnusedFrames = 300;
+
     protected:
+        struct PipelineEntry
+        {
+            // the pass address can be reused once it is destroyed
+            std::weak_ptr<GFXShaderPass> ShaderPass;
+            std::shared_ptr<GFXGraphicsPipeline> Pipeline;
+            uint64_t LastUsedFrame;
+        };
+
+        void LoadPipelineCache();
+
         GFXVulkanApplication* m_app;
-        std::unordered_map<intptr_t, std::shared_ptr<GFXGraphicsPipeline>> m_caches;
+        VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
+
+        // pipelines are looked up from every recording thread
+        std::mutex m_mutex;
+        std::unordered_map<GFXGraphicsPipelineKey, PipelineEntry, GFXGraphicsPipelineKeyHash> m_caches;
+        uint64_t m_frame{};
     };
-}
\ No newline at end of file
+}
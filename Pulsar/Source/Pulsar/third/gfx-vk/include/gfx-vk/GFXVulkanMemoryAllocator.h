@@ -0,0 +1,70 @@
+#pragma once
+#include "VulkanInclude.h"
+#include <gfx/GFXMemoryStatistics.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace gfx
+{
+    class GFXVulkanApplication;
+
+    struct GFXVulkanMemoryBlock
+    {
+        VkDeviceMemory Memory = VK_NULL_HANDLE;
+        VkDeviceSize Size{};
+        uint32_t MemoryType{};
+        bool IsLinear{};
+        bool IsDedicated{};
+        // host visible blocks stay mapped for their whole lifetime
+        uint8_t* MappedData = nullptr;
+
+        // offset -> size
+        std::map<VkDeviceSize, VkDeviceSize> FreeRanges;
+        VkDeviceSize UsedSize{};
+        size_t AllocationCount{};
+
+        bool TryAllocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* outOffset);
+        void Free(VkDeviceSize offset, VkDeviceSize size);
+    };
+
+    struct GFXVulkanMemoryAllocation
+    {
+        VkDeviceMemory Memory = VK_NULL_HANDLE;
+        VkDeviceSize Offset{};
+        VkDeviceSize Size{};
+        void* MappedData = nullptr;
+        GFXVulkanMemoryBlock* Block = nullptr;
+
+        bool IsValid() const { return Block != nullptr; }
+    };
+
+    // sub allocates buffers and images from large device memory blocks.
+    // buffers and images use separate block lists per memory type, so bufferImageGranularity never applies
+    class GFXVulkanMemoryAllocator
+    {
+    public:
+        explicit GFXVulkanMemoryAllocator(GFXVulkanApplication* app);
+        ~GFXVulkanMemoryAllocator();
+        GFXVulkanMemoryAllocator(const GFXVulkanMemoryAllocator&) = delete;
+    public:
+        uint32_t FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const;
+        const VkPhysicalDeviceMemoryProperties& GetMemoryProperties() const { return m_memoryProperties; }
+
+        GFXVulkanMemoryAllocation Allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, bool isLinear);
+        void Free(GFXVulkanMemoryAllocation& allocation);
+
+        GFXMemoryStatistics GetStatistics() const;
+    private:
+        GFXVulkanMemoryBlock* CreateBlock(uint32_t memoryType, VkDeviceSize size, bool isLinear);
+        void DestroyBlock(GFXVulkanMemoryBlock* block);
+        VkDeviceSize GetPreferredBlockSize(uint32_t memoryType) const;
+    private:
+        GFXVulkanApplication* m_app;
+        VkPhysicalDeviceMemoryProperties m_memoryProperties{};
+
+        std::vector<std::unique_ptr<GFXVulkanMemoryBlock>> m_blocks[VK_MAX_MEMORY_TYPES * 2];
+        mutable std::mutex m_mutex;
+    };
+}
@@ -37,6 +37,10 @@ namespace gfx
         {
             return m_buffers[index];
         }
+        virtual size_t GetCommandBufferCount() const override
+        {
+            return m_buffers.size();
+        }
     public:
         GFXVulkanQueue* GetQueue() const { return m_queue; }
         void SetQueue(GFXVulkanQueue* queue) { m_queue = queue; }
@@ -1,6 +1,7 @@
 #pragma once
 #include "VulkanInclude.h"
 
+#include "GFXVulkanMemoryAllocator.h"
 #include <gfx/GFXTexture.h>
 #include <map>
 
@@ -62,7 +63,7 @@ namespace gfx
         VkImage m_textureImage{};
         VkImageLayout m_imageLayout;
         VkImageLayout m_targetFinalLayout;
-        VkDeviceMemory m_textureImageMemory{};
+        GFXVulkanMemoryAllocation m_textureImageMemory{};
         VkImageView m_textureImageView{};
         VkSampler m_textureSampler{};
         VkFormat m_imageFormat;
@@ -0,0 +1,77 @@
+#pragma once
+#include "VulkanInclude.h"
+#include "GFXVulkanMemoryAllocator.h"
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace gfx
+{
+    class GFXVulkanApplication;
+
+    // batches staging copies into one command buffer per flush instead of waiting the queue for every upload.
+    // staging memory comes from a persistent ring and is reclaimed once the submission fence signals.
+    class GFXVulkanUploadManager
+    {
+    public:
+        GFXVulkanUploadManager(GFXVulkanApplication* app, VkDeviceSize stagingSize);
+        GFXVulkanUploadManager(const GFXVulkanUploadManager&) = delete;
+        ~GFXVulkanUploadManager();
+    public:
+        // copies data to staging memory now, the gpu copy runs with the next Flush.
+        // returns the upload id to query with IsRetired or WaitFor.
+        uint64_t UploadBuffer(VkBuffer dest, VkDeviceSize destOffset, const void* data, VkDeviceSize size);
+
+        // submits all recorded copies, later submissions on the graphics queue see the data
+        void Flush();
+        // reclaims staging memory of finished submissions without blocking
+        void Retire();
+        void WaitFor(uint64_t uploadId);
+        void WaitIdle();
+
+        bool IsRetired(uint64_t uploadId) const { return uploadId <= m_retiredId; }
+        uint64_t GetRecordingId() const { return m_recordingId; }
+        size_t GetPendingCopyCount() const { return m_recordingCopyCount; }
+        size_t GetInFlightCount() const { return m_submissions.size(); }
+        VkDeviceSize GetStagingSize() const { return m_stagingSize; }
+        VkDeviceSize GetStagingUsedSize() const { return m_stagingUsed; }
+    private:
+        struct TemporaryStaging
+        {
+            VkBuffer Buffer;
+            GFXVulkanMemoryAllocation Memory;
+        };
+        struct Submission
+        {
+            uint64_t Id;
+            VkFence Fence;
+            VkCommandBuffer Cmd;
+            VkDeviceSize StagingConsumed;
+            std::vector<TemporaryStaging> Temporaries;
+        };
+
+        bool TryAllocateStaging(VkDeviceSize size, VkDeviceSize& offset);
+        VkCommandBuffer GetRecordingCommandBuffer();
+        VkFence AcquireFence();
+        void RetireFront();
+    private:
+        GFXVulkanApplication* m_app;
+
+        VkBuffer m_stagingBuffer = VK_NULL_HANDLE;
+        GFXVulkanMemoryAllocation m_stagingMemory{};
+        VkDeviceSize m_stagingSize{};
+        VkDeviceSize m_stagingHead{};
+        VkDeviceSize m_stagingTail{};
+        VkDeviceSize m_stagingUsed{};
+
+        VkCommandBuffer m_recordingCmd = VK_NULL_HANDLE;
+        VkDeviceSize m_recordingConsumed{};
+        size_t m_recordingCopyCount{};
+        std::vector<TemporaryStaging> m_recordingTemporaries;
+        uint64_t m_recordingId = 1;
+        uint64_t m_retiredId = 0;
+
+        std::deque<Submission> m_submissions;
+        std::vector<VkFence> m_freeFences;
+    };
+}
@@ -38,6 +38,8 @@ namespace gfx
         VkFormat GetVkSwapChainImageFormat() const { return m_swapChainImageFormat; }
         GFXVulkanApplication* GetApplication() const { return m_app; }
         GFXVulkanQueue* GetQueue() const { return m_queues[m_currentFrame].get(); }
+        // advances to the next frame in flight slot, returns its index
+        uint32_t NextFrame();
         VkResult AcquireNextImage(uint32_t* outIndex);
     public:
         virtual GFXFrameBufferObject* GetFrameBufferObject() override;
@@ -1,5 +1,6 @@
 #pragma once
 #include "GFXVulkanApplication.h"
+#include "GFXVulkanMemoryAllocator.h"
 #include <vector>
 
 namespace gfx
@@ -17,7 +18,7 @@ namespace gfx
 
         static void CreateImage(GFXVulkanApplication* app,
             VkImageCreateInfo* info, VkMemoryPropertyFlags properties,
-            VkImage& image, VkDeviceMemory& imageMemory);
+            VkImage& image, GFXVulkanMemoryAllocation& imageMemory);
 
 
         static VkImageViewCreateInfo ImageViewCreateInfo();
@@ -8,19 +8,7 @@ namespace gfx
 {
     uint32_t BufferHelper::FindMemoryType(GFXVulkanApplication* app, uint32_t typeFilter, VkMemoryPropertyFlags properties)
     {
-        VkPhysicalDeviceMemoryProperties memProperties;
-        vkGetPhysicalDeviceMemoryProperties(app->GetVkPhysicalDevice(), &memProperties);
-
-        for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++)
-        {
-            if ((typeFilter & (1 << i)) &&
-                (memProperties.memoryTypes[i].propertyFlags & properties) == properties)
-            {
-                return i;
-            }
-        }
-
-        throw std::runtime_error("failed to find suitable memory type!");
+        return app->GetMemoryAllocator()->FindMemoryType(typeFilter, properties);
     }
 
     void BufferHelper::CreateBuffer(
@@ -29,7 +17,7 @@ namespace gfx
         VkBufferUsageFlags usage,
         VkMemoryPropertyFlags properties,
         VkBuffer& buffer,
-        VkDeviceMemory& bufferMemory)
+        GFXVulkanMemoryAllocation& bufferMemory)
     {
         VkBufferCreateInfo bufferInfo{};
         bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -45,17 +33,9 @@ namespace gfx
         VkMemoryRequirements memRequirements;
         vkGetBufferMemoryRequirements(app->GetVkDevice(), buffer, &memRequirements);
 
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = FindMemoryType(app, memRequirements.memoryTypeBits, properties);
-
-        if (vkAllocateMemory(app->GetVkDevice(), &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS)
-        {
-            throw std::runtime_error("failed to allocate buffer memory!");
-        }
+        bufferMemory = app->GetMemoryAllocator()->Allocate(memRequirements, properties, true);
 
-        vkBindBufferMemory(app->GetVkDevice(), buffer, bufferMemory, 0);
+        vkBindBufferMemory(app->GetVkDevice(), buffer, bufferMemory.Memory, bufferMemory.Offset);
     }
 
     void BufferHelper::TransferBuffer(GFXVulkanApplication* app, VkBuffer src, VkBuffer dest, VkDeviceSize size)
@@ -88,10 +68,10 @@ namespace gfx
         vkQueueWaitIdle(app->GetVkGraphicsQueue());
     }
 
-    void BufferHelper::DestroyBuffer(GFXVulkanApplication* app, VkBuffer buffer, VkDeviceMemory mem)
+    void BufferHelper::DestroyBuffer(GFXVulkanApplication* app, VkBuffer buffer, GFXVulkanMemoryAllocation& mem)
     {
         vkDestroyBuffer(app->GetVkDevice(), buffer, nullptr);
-        vkFreeMemory(app->GetVkDevice(), mem, nullptr);
+        app->GetMemoryAllocator()->Free(mem);
     }
 
 
@@ -5,13 +5,17 @@
 #include "GFXVulkanCommandBuffer.h"
 #include "GFXVulkanCommandBufferPool.h"
 #include "GFXVulkanDescriptorManager.h"
+#include "GFXVulkanDynamicBuffer.h"
+#include "GFXVulkanFrameResources.h"
 #include "GFXVulkanGpuProgram.h"
 #include "GFXVulkanGraphicsPipeline.h"
 #include "GFXVulkanGraphicsPipelineManager.h"
+#include "GFXVulkanMemoryAllocator.h"
 #include "GFXVulkanRenderPass.h"
 #include "GFXVulkanRenderer.h"
 #include "GFXVulkanShaderPass.h"
 #include "GFXVulkanTexture.h"
+#include "GFXVulkanUploadManager.h"
 #include "GFXVulkanVertexLayoutDescription.h"
 #include "GFXVulkanViewport.h"
 #include "PhysicalDeviceHelper.h"
@@ -29,6 +33,10 @@
 
 namespace gfx
 {
+    static constexpr size_t kDynamicBufferFrameCapacity = 8 * 1024 * 1024;
+    static constexpr size_t kDynamicBufferMaxBindingRange = 64 * 1024;
+    static constexpr size_t kUploadStagingSize = 32 * 1024 * 1024;
+
     GFXExtensions GFXVulkanApplication::GetExtensionNames()
     {
         if (m_extensions.empty())
@@ -394,12 +402,21 @@ namespace gfx
         // }
 
         this->InitPickPhysicalDevice();
+        vkGetPhysicalDeviceProperties(m_physicalDevice, &m_physicalDeviceProperties);
         this->InitLogicalDevice();
 
+        m_frameResources = new GFXVulkanFrameResources(MAX_FRAMES_IN_FLIGHT);
+
+        m_memoryAllocator = new GFXVulkanMemoryAllocator(this);
+
         m_cmdPool = new GFXVulkanCommandBufferPool(this);
 
+        m_uploadManager = new GFXVulkanUploadManager(this, kUploadStagingSize);
+
         m_descriptorManager = new GFXVulkanDescriptorManager(this);
 
+        m_dynamicBuffer = new GFXVulkanDynamicBuffer(this, kDynamicBufferFrameCapacity, kDynamicBufferMaxBindingRange, MAX_FRAMES_IN_FLIGHT);
+
         m_viewport = new GFXVulkanViewport(this, m_window);
 
         m_renderer = new GFXVulkanRenderer(this);
@@ -466,8 +483,16 @@ namespace gfx
         delete m_renderer;
         delete m_viewport;
         delete m_graphicsPipelineManager;
+        delete m_dynamicBuffer;
+
+        // runs the pending destroyers, anything released later is destroyed immediately
+        delete m_frameResources;
+        m_frameResources = nullptr;
+
         delete m_descriptorManager;
+        delete m_uploadManager;
         delete m_cmdPool;
+        delete m_memoryAllocator;
 
         vkDestroyDevice(m_device, nullptr);
 
@@ -494,7 +519,18 @@ namespace gfx
 
     GFXBuffer_sp GFXVulkanApplication::CreateBuffer(GFXBufferUsage usage, size_t bufferSize)
     {
-        return gfxmksptr(new GFXVulkanBuffer(this, usage, bufferSize));
+        return gfxmksptr(new GFXVulkanBuffer(this, usage, bufferSize, 0, MAX_FRAMES_IN_FLIGHT));
+    }
+    void GFXVulkanApplication::DeferDestroy(std::function<void()>&& destroyer)
+    {
+        if (m_frameResources)
+        {
+            m_frameResources->DeferDestroy(std::move(destroyer));
+        }
+        else
+        {
+            destroyer();
+        }
     }
     GFXCommandBuffer_sp gfx::GFXVulkanApplication::CreateCommandBuffer()
     {
@@ -587,6 +623,16 @@ namespace gfx
         return m_descriptorManager;
     }
 
+    GFXDynamicBuffer* GFXVulkanApplication::GetDynamicBuffer()
+    {
+        return m_dynamicBuffer;
+    }
+
+    GFXMemoryStatistics GFXVulkanApplication::GetMemoryStatistics() const
+    {
+        return m_memoryAllocator->GetStatistics();
+    }
+
     GFXDescriptorSetLayout_sp GFXVulkanApplication::CreateDescriptorSetLayout(
         const GFXDescriptorSetLayoutInfo* layouts,
         size_t layoutCount)
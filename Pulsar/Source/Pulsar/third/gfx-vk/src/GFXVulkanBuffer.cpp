@@ -1,14 +1,18 @@
 #include <gfx-vk/GFXVulkanBuffer.h>
 #include <gfx-vk/GFXVulkanApplication.h>
 #include <gfx-vk/BufferHelper.h>
+#include <gfx-vk/GFXVulkanUploadManager.h>
+#include <gfx-vk/GFXVulkanFrameResources.h>
+#include <algorithm>
+#include <cstring>
 #include <cassert>
 #include <stdexcept>
 
 namespace gfx
 {
 
-    GFXVulkanBuffer::GFXVulkanBuffer(GFXVulkanApplication* app, GFXBufferUsage usage, size_t bufferSize)
-        : m_app(app), base(usage, bufferSize)
+    GFXVulkanBuffer::GFXVulkanBuffer(GFXVulkanApplication* app, GFXBufferUsage usage, size_t bufferSize, VkBufferUsageFlags extraUsage, uint32_t frameCount)
+        : m_app(app), base(usage, bufferSize), m_extraUsage(extraUsage)
     {
 
         if (IsGpuLocalMemory())
@@ -21,7 +25,17 @@ namespace gfx
         }
         else
         {
-            BufferHelper::CreateBuffer(m_app, m_bufferSize,
+            m_frameCount = std::max(frameCount, 1u);
+            m_frameStride = m_bufferSize;
+            if (m_frameCount > 1)
+            {
+                const auto& limits = m_app->GetVkPhysicalDeviceProperties().limits;
+                const auto alignment = std::max(limits.minUniformBufferOffsetAlignment, limits.minStorageBufferOffsetAlignment);
+                m_frameStride = (m_bufferSize + alignment - 1) / alignment * alignment;
+                m_frameShadow.resize(m_bufferSize);
+            }
+
+            BufferHelper::CreateBuffer(m_app, m_frameStride * m_frameCount,
                 GetVkUsage(),
                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
                 m_vkBuffer, m_vkBufferMemory);
@@ -33,8 +47,7 @@ namespace gfx
     {
         if (m_hasData)
         {
-            BufferHelper::DestroyBuffer(m_app, m_vkBuffer, m_vkBufferMemory);
-            m_hasData = false;
+            DestroyVkBuffer();
         }
         // if (this->IsValid())
         // {
@@ -48,41 +61,89 @@ namespace gfx
     {
         if (IsGpuLocalMemory())
         {
-            //create staging buffer
-            VkBuffer stagingBuffer;
-            VkDeviceMemory stagingBufferMemory;
-            BufferHelper::CreateBuffer(m_app, m_bufferSize,
-                VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
-                VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                stagingBuffer, stagingBufferMemory
-            );
+            m_uploadId = m_app->GetUploadManager()->UploadBuffer(m_vkBuffer, 0, data, m_bufferSize);
+        }
+        else if (m_frameCount == 1)
+        {
+            memcpy(m_vkBufferMemory.MappedData, data, m_bufferSize);
+        }
+        else
+        {
+            // frames in flight may still read the other copies, they are refreshed when their slot begins
+            memcpy(m_frameShadow.data(), data, m_bufferSize);
+
+            const auto frames = m_app->GetFrameResources();
+            m_staleFrameMask = frames->GetAllFramesMask();
+            if (frames->IsRecording())
+            {
+                UpdateFrame(frames->GetFrameIndex());
+            }
+            if (m_staleFrameMask != 0)
+            {
+                frames->AddStale(this);
+            }
+        }
 
-            void* memData;
-            vkMapMemory(m_app->GetVkDevice(), stagingBufferMemory, 0, m_bufferSize, 0, &memData);
-            memcpy(memData, data, m_bufferSize);
-            vkUnmapMemory(m_app->GetVkDevice(), stagingBufferMemory);
+    }
+
+    bool GFXVulkanBuffer::IsUploadRetired() const
+    {
+        return m_uploadId == 0 || m_app->GetUploadManager()->IsRetired(m_uploadId);
+    }
 
-            //transfer
-            BufferHelper::TransferBuffer(m_app, stagingBuffer, m_vkBuffer, m_bufferSize);
-            BufferHelper::DestroyBuffer(m_app, stagingBuffer, stagingBufferMemory);
+    void GFXVulkanBuffer::WaitUpload()
+    {
+        // the pending copy still writes into this buffer
+        if (m_uploadId != 0)
+        {
+            m_app->GetUploadManager()->WaitFor(m_uploadId);
+            m_uploadId = 0;
         }
-        else
+    }
+
+    bool GFXVulkanBuffer::UpdateFrame(uint32_t frameIndex)
+    {
+        const uint32_t frameBit = 1u << frameIndex;
+        if (m_staleFrameMask & frameBit)
+        {
+            auto dest = static_cast<uint8_t*>(m_vkBufferMemory.MappedData) + GetFrameOffset(frameIndex);
+            memcpy(dest, m_frameShadow.data(), m_bufferSize);
+            m_staleFrameMask &= ~frameBit;
+        }
+        return m_staleFrameMask == 0;
+    }
+
+    void GFXVulkanBuffer::DestroyVkBuffer()
+    {
+        WaitUpload();
+        if (m_staleFrameMask != 0)
         {
-            void* gpuData;
-            vkMapMemory(m_app->GetVkDevice(), m_vkBufferMemory, 0, m_bufferSize, 0, &gpuData);
-            memcpy(gpuData, data, m_bufferSize);
-            vkUnmapMemory(m_app->GetVkDevice(), m_vkBufferMemory);
+            if (auto frames = m_app->GetFrameResources())
+            {
+                frames->RemoveStale(this);
+            }
+            m_staleFrameMask = 0;
         }
 
+        m_app->DeferDestroy([app = m_app, buffer = m_vkBuffer, memory = m_vkBufferMemory]() mutable {
+            BufferHelper::DestroyBuffer(app, buffer, memory);
+        });
+        m_vkBuffer = VK_NULL_HANDLE;
+        m_vkBufferMemory = {};
+        m_hasData = false;
+    }
+
+    void* GFXVulkanBuffer::Map()
+    {
+        assert(!IsGpuLocalMemory() && m_frameCount == 1);
+        return m_vkBufferMemory.MappedData;
     }
 
     void GFXVulkanBuffer::Release()
     {
         if (m_hasData)
         {
-            BufferHelper::DestroyBuffer(m_app, m_vkBuffer, m_vkBufferMemory);
-            m_hasData = false;
+            DestroyVkBuffer();
         }
     }
 
@@ -107,7 +168,7 @@ namespace gfx
             assert(false);
             break;
         }
-        return vkUsage;
+        return vkUsage | m_extraUsage;
     }
 
     bool GFXVulkanBuffer::IsGpuLocalMemory() const
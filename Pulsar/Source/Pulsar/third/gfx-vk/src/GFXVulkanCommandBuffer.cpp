@@ -10,13 +10,15 @@ namespace gfx
     GFXVulkanCommandBuffer::GFXVulkanCommandBuffer(GFXVulkanApplication* app)
         : m_app(app)
     {
-        m_cmdBuffer = app->GetCommandBufferPool()->GetVkCommandBuffer();
     }
     GFXVulkanCommandBuffer::~GFXVulkanCommandBuffer()
     {
         if (m_cmdBuffer != VK_NULL_HANDLE)
         {
-            m_app->GetCommandBufferPool()->ReleaseCommandBuffer(m_cmdBuffer);
+            // the frame that submitted the buffer may still be executing
+            m_app->DeferDestroy([pool = m_app->GetCommandBufferPool(), cmdBuffer = m_cmdBuffer]() {
+                pool->ReleaseCommandBuffer(cmdBuffer);
+            });
             m_cmdBuffer = VK_NULL_HANDLE;
         }
     }
@@ -25,6 +27,8 @@ namespace gfx
         m_app = r.m_app;
         m_cmdBuffer = r.m_cmdBuffer;
         m_fbo = r.m_fbo;
+        m_bindState = r.m_bindState;
+        m_stats = r.m_stats;
 
         r.m_cmdBuffer = VK_NULL_HANDLE;
     }
@@ -163,7 +167,17 @@ namespace gfx
     }
     void GFXVulkanCommandBuffer::Begin()
     {
-        vkResetCommandBuffer(m_cmdBuffer, /*VkCommandBufferResetFlagBits*/ 0);
+        if (m_cmdBuffer == VK_NULL_HANDLE)
+        {
+            // taken from the pool of the recording thread
+            m_cmdBuffer = m_app->GetCommandBufferPool()->GetVkCommandBuffer();
+        }
+        else
+        {
+            vkResetCommandBuffer(m_cmdBuffer, /*VkCommandBufferResetFlagBits*/ 0);
+        }
+        m_bindState.Reset();
+        m_stats = {};
 
         VkCommandBufferBeginInfo beginInfo{};
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -183,19 +197,31 @@ namespace gfx
 
     void GFXVulkanCommandBuffer::CmdBindGraphicsPipeline(GFXGraphicsPipeline* pipeline)
     {
-        auto vkpipeline = static_cast<GFXVulkanGraphicsPipeline*>(pipeline);
-        vkCmdBindPipeline(m_cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkpipeline->GetVkPipeline());
+        auto vkpipeline = static_cast<GFXVulkanGraphicsPipeline*>(pipeline)->GetVkPipeline();
+        if (!m_bindState.BindPipeline(vkpipeline, m_stats))
+        {
+            return;
+        }
+        vkCmdBindPipeline(m_cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkpipeline);
     }
 
     void GFXVulkanCommandBuffer::CmdBindVertexBuffers(const std::vector<GFXBuffer*>& buffers)
     {
-        std::vector<VkBuffer> vkbuffers;
-        for (auto& item : buffers)
+        assert(buffers.size() <= BindState::kMaxVertexBuffers);
+        const auto count = static_cast<uint32_t>(buffers.size());
+
+        std::array<VkBuffer, BindState::kMaxVertexBuffers> vkbuffers{};
+        for (uint32_t i = 0; i < count; ++i)
         {
-            vkbuffers.push_back(static_cast<GFXVulkanBuffer*>(item)->GetVkBuffer());
+            vkbuffers[i] = static_cast<GFXVulkanBuffer*>(buffers[i])->GetVkBuffer();
         }
-        VkDeviceSize offsets[] = { 0 };
-        vkCmdBindVertexBuffers(m_cmdBuffer, 0, static_cast<uint32_t>(buffers.size()), vkbuffers.data(), offsets);
+        if (!m_bindState.BindVertexBuffers(vkbuffers.data(), count, m_stats))
+        {
+            return;
+        }
+
+        std::array<VkDeviceSize, BindState::kMaxVertexBuffers> offsets{};
+        vkCmdBindVertexBuffers(m_cmdBuffer, 0, count, vkbuffers.data(), offsets.data());
     }
 
     static VkIndexType _GetVkIndexType(size_t size)
@@ -214,40 +240,66 @@ namespace gfx
 
     void GFXVulkanCommandBuffer::CmdBindIndexBuffer(GFXBuffer* buffer)
     {
-        vkCmdBindIndexBuffer(m_cmdBuffer,
-            static_cast<GFXVulkanBuffer*>(buffer)->GetVkBuffer(),
-            0,
-            _GetVkIndexType(buffer->GetElementSize()));
+        const auto vkbuffer = static_cast<GFXVulkanBuffer*>(buffer)->GetVkBuffer();
+        if (!m_bindState.BindIndexBuffer(vkbuffer, buffer->GetElementSize(), m_stats))
+        {
+            return;
+        }
+        vkCmdBindIndexBuffer(m_cmdBuffer, vkbuffer, 0, _GetVkIndexType(buffer->GetElementSize()));
     }
 
-    void GFXVulkanCommandBuffer::CmdBindDescriptorSets(const array_list<GFXDescriptorSet*>& descriptorSet, GFXGraphicsPipeline* pipeline)
+    void GFXVulkanCommandBuffer::CmdBindDescriptorSets(
+        const array_list<GFXDescriptorSet*>& descriptorSet, GFXGraphicsPipeline* pipeline,
+        const array_list<uint32_t>& dynamicOffsets)
     {
-        VkDescriptorSet sets[8]{};
-        for (int i = 0; const auto set : descriptorSet)
+        assert(descriptorSet.size() <= BindState::kMaxDescriptorSets);
+        const auto count = static_cast<uint32_t>(descriptorSet.size());
+
+        BindState::DescriptorSets sets{};
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const auto vkDescSet = static_cast<GFXVulkanDescriptorSet*>(descriptorSet[i]);
+            const auto& layout = vkDescSet->GetVkDescriptorSetLayout();
+
+            auto& set = sets[i];
+            set.Set = vkDescSet->GetVkDescriptorSet();
+            set.Layout = layout->GetVkDescriptorSetLayout();
+            set.DynamicOffsetCount = layout->GetDynamicDescriptorCount();
+        }
+
+        uint32_t firstChangedOffset = 0;
+        const auto firstChanged = m_bindState.BindDescriptorSets(sets, count, dynamicOffsets, firstChangedOffset, m_stats);
+        if (firstChanged == count)
+        {
+            return;
+        }
+
+        std::array<VkDescriptorSet, BindState::kMaxDescriptorSets> vkSets{};
+        for (uint32_t i = firstChanged; i < count; ++i)
         {
-            const auto vkDescSet = static_cast<GFXVulkanDescriptorSet*>(set);
-            sets[i] = vkDescSet->GetVkDescriptorSet();
-            ++i;
+            vkSets[i - firstChanged] = sets[i].Set;
         }
 
         const auto vkGpipeline = static_cast<GFXVulkanGraphicsPipeline*>(pipeline);
         vkCmdBindDescriptorSets(m_cmdBuffer,
             VK_PIPELINE_BIND_POINT_GRAPHICS,
             vkGpipeline->GetVkPipelineLayout(),
-            0,
-            descriptorSet.size(),
-            sets,
-            0,
-            nullptr);
+            firstChanged,
+            count - firstChanged,
+            vkSets.data(),
+            static_cast<uint32_t>(dynamicOffsets.size()) - firstChangedOffset,
+            dynamicOffsets.data() + firstChangedOffset);
     }
 
-    void GFXVulkanCommandBuffer::CmdDrawIndexed(size_t indicesCount)
+    void GFXVulkanCommandBuffer::CmdDrawIndexed(size_t indicesCount, uint32_t instanceCount)
     {
-        vkCmdDrawIndexed(m_cmdBuffer, static_cast<uint32_t>(indicesCount), 1, 0, 0, 0);
+        ++m_stats.DrawCount;
+        vkCmdDrawIndexed(m_cmdBuffer, static_cast<uint32_t>(indicesCount), instanceCount, 0, 0, 0);
     }
 
     void GFXVulkanCommandBuffer::CmdDraw(size_t vertexCount)
     {
+        ++m_stats.DrawCount;
         vkCmdDraw(m_cmdBuffer, vertexCount, 1, 0, 0);
     }
 
@@ -2,6 +2,7 @@
 #include "GFXVulkanApplication.h"
 #include "PhysicalDeviceHelper.h"
 #include <cassert>
+#include <stdexcept>
 
 namespace gfx
 {
@@ -9,58 +10,108 @@ namespace gfx
         : m_app(app)
     {
         vk::QueueFamilyIndices queueFamilyIndices = vk::PhysicalDeviceHelper::FindQueueFamilies(app->GetVkSurface(), app->GetVkPhysicalDevice());
+        m_queueFamilyIndex = queueFamilyIndices.graphicsFamily.value();
 
-        VkCommandPoolCreateInfo poolInfo{};
-        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        poolInfo.queueFamilyIndex = queueFamilyIndices.graphicsFamily.value();
-
-        if (vkCreateCommandPool(app->GetVkDevice(), &poolInfo, nullptr, &m_pool) != VK_SUCCESS)
+        // create the pool of the render thread up front
+        GetThreadPool();
+    }
+    GFXVulkanCommandBufferPool::~GFXVulkanCommandBufferPool()
+    {
+        for (auto& [id, threadPool] : m_threadPools)
         {
-            throw std::runtime_error("failed to create command pool!");
+            vkDestroyCommandPool(m_app->GetVkDevice(), threadPool->Pool, nullptr);
         }
     }
-    GFXVulkanCommandBufferPool::~GFXVulkanCommandBufferPool()
+
+    GFXVulkanCommandBufferPool::ThreadPool* GFXVulkanCommandBufferPool::GetThreadPool()
     {
-        vkDestroyCommandPool(m_app->GetVkDevice(), m_pool, nullptr);
+        struct ThreadCache
+        {
+            const GFXVulkanCommandBufferPool* Owner;
+            ThreadPool* Pool;
+        };
+        thread_local ThreadCache cache{};
+        if (cache.Owner == this)
+        {
+            return cache.Pool;
+        }
+
+        std::lock_guard lock{m_mutex};
+        auto& threadPool = m_threadPools[std::this_thread::get_id()];
+        if (!threadPool)
+        {
+            threadPool = std::make_unique<ThreadPool>();
+
+            VkCommandPoolCreateInfo poolInfo{};
+            poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+            poolInfo.queueFamilyIndex = m_queueFamilyIndex;
+
+            if (vkCreateCommandPool(m_app->GetVkDevice(), &poolInfo, nullptr, &threadPool->Pool) != VK_SUCCESS)
+            {
+                throw std::runtime_error("failed to create command pool!");
+            }
+        }
+        cache = {this, threadPool.get()};
+        return threadPool.get();
     }
 
     VkCommandBuffer GFXVulkanCommandBufferPool::GetVkCommandBuffer()
     {
-        if (m_initial.size() == 0)
+        auto threadPool = GetThreadPool();
+
+        std::vector<VkCommandBuffer> released;
         {
-            AllocCommandBuffer();
+            std::lock_guard lock{threadPool->ReleasedMutex};
+            released.swap(threadPool->Released);
+        }
+        for (auto buffer : released)
+        {
+            vkResetCommandBuffer(buffer, 0);
+            threadPool->Initial.push(buffer);
         }
-        assert(m_initial.size() != 0);
 
-        auto buf = m_initial.front();
-        m_initial.pop();
+        if (threadPool->Initial.size() == 0)
+        {
+            AllocCommandBuffer(threadPool);
+        }
+        assert(threadPool->Initial.size() != 0);
+
+        auto buf = threadPool->Initial.front();
+        threadPool->Initial.pop();
         return buf;
     }
     void GFXVulkanCommandBufferPool::ReleaseCommandBuffer(VkCommandBuffer buffer)
     {
-        vkResetCommandBuffer(buffer, 0);
-        m_initial.push(buffer);
+        ThreadPool* owner;
+        {
+            std::lock_guard lock{m_mutex};
+            owner = m_owners.at(buffer);
+        }
+        std::lock_guard lock{owner->ReleasedMutex};
+        owner->Released.push_back(buffer);
     }
 
-    void GFXVulkanCommandBufferPool::AllocCommandBuffer()
+    void GFXVulkanCommandBufferPool::AllocCommandBuffer(ThreadPool* threadPool)
     {
         const int allocSize = 3;
 
         VkCommandBufferAllocateInfo allocInfo{};
         allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        allocInfo.commandPool = m_pool;
+        allocInfo.commandPool = threadPool->Pool;
         allocInfo.commandBufferCount = allocSize;
-        
+
         VkCommandBuffer buffers[allocSize]{};
 
         vkAllocateCommandBuffers(m_app->GetVkDevice(), &allocInfo, buffers);
 
+        std::lock_guard lock{m_mutex};
         for (size_t i = 0; i < allocSize; i++)
         {
-            m_initial.push(buffers[i]);
+            threadPool->Initial.push(buffers[i]);
+            m_owners.emplace(buffers[i], threadPool);
         }
     }
 
-}
\ No newline at end of file
+}
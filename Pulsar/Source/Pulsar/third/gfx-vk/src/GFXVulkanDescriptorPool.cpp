@@ -2,6 +2,7 @@
 #include <gfx-vk/GFXVulkanApplication.h>
 #include <gfx-vk/VulkanInclude.h>
 #include <gfx-vk/GFXVulkanDescriptorSet.h>
+#include <gfx-vk/GFXVulkanFrameResources.h>
 #include <unordered_map>
 #include <stdexcept>
 #include <cassert>
@@ -55,17 +56,18 @@ namespace gfx
 
     std::shared_ptr<GFXVulkanDescriptorSet> GFXVulkanDescriptorPool::GetDescriptorSet(const GFXDescriptorSetLayout_sp& layout)
     {
-        if (m_count == m_maxSetCount)
+        const uint32_t frameCount = m_app->GetFrameResources()->GetFrameCount();
+        if (m_count + frameCount > m_maxSetCount)
         {
             return nullptr;
         }
 
-        ++m_count;
-        return std::shared_ptr<GFXVulkanDescriptorSet>{ new GFXVulkanDescriptorSet(this, layout) };
+        m_count += frameCount;
+        return std::shared_ptr<GFXVulkanDescriptorSet>{ new GFXVulkanDescriptorSet(this, layout, frameCount) };
     }
 
-    void GFXVulkanDescriptorPool::ReleaseDescriptorSet()
+    void GFXVulkanDescriptorPool::ReleaseDescriptorSet(size_t setCount)
     {
-        --m_count;
+        m_count -= setCount;
     }
 }
\ No newline at end of file
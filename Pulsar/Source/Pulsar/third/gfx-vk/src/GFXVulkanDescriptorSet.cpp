@@ -3,6 +3,7 @@
 #include <gfx-vk/GFXVulkanBuffer.h>
 #include <gfx-vk/GFXVulkanDescriptorPool.h>
 #include <gfx-vk/GFXVulkanDescriptorSet.h>
+#include <gfx-vk/GFXVulkanFrameResources.h>
 #include <gfx-vk/GFXVulkanTexture.h>
 #include <stdexcept>
 
@@ -36,6 +37,10 @@ namespace gfx
             return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
         case gfx::GFXDescriptorType::StructuredBuffer:
             return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        case gfx::GFXDescriptorType::DynamicConstantBuffer:
+            return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        case gfx::GFXDescriptorType::DynamicStructuredBuffer:
+            return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
         default:
             assert(false);
             break;
@@ -67,7 +72,7 @@ namespace gfx
         for (size_t i = 0; i < layoutCount; ++i)
         {
             const auto layoutInfo = layouts[i];
-            m_debugInfo.push_back(layoutInfo);
+            m_layoutInfos.push_back(layoutInfo);
 
             VkDescriptorSetLayoutBinding& binding = bindings.emplace_back();
             binding.binding = layoutInfo.BindingPoint;
@@ -75,6 +80,12 @@ namespace gfx
             binding.descriptorCount = 1;
             binding.stageFlags = _GetShaderStage(layoutInfo.Stage);
             binding.pImmutableSamplers = nullptr;
+
+            if (layoutInfo.Type == GFXDescriptorType::DynamicConstantBuffer ||
+                layoutInfo.Type == GFXDescriptorType::DynamicStructuredBuffer)
+            {
+                ++m_dynamicDescriptorCount;
+            }
         }
         VkDescriptorSetLayoutCreateInfo layoutCreateInfo{};
         layoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
@@ -100,12 +111,12 @@ namespace gfx
     {
         const auto vkBuffer = static_cast<GFXVulkanBuffer*>(buffer);
 
+        BufferFrameStride = vkBuffer->GetFrameOffset(1);
         BufferInfo.buffer = vkBuffer->GetVkBuffer();
         BufferInfo.offset = 0;
         BufferInfo.range = vkBuffer->GetSize();
 
         WriteInfo.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        WriteInfo.dstSet = m_descriptorSet->GetVkDescriptorSet();
         WriteInfo.dstBinding = m_bindingPoint;
         WriteInfo.dstArrayElement = 0;
         WriteInfo.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
@@ -118,12 +129,12 @@ namespace gfx
     {
         const auto vkBuffer = static_cast<GFXVulkanBuffer*>(buffer);
 
+        BufferFrameStride = vkBuffer->GetFrameOffset(1);
         BufferInfo.buffer = vkBuffer->GetVkBuffer();
         BufferInfo.offset = 0;
         BufferInfo.range = vkBuffer->GetSize();
 
         WriteInfo.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        WriteInfo.dstSet = m_descriptorSet->GetVkDescriptorSet();
         WriteInfo.dstBinding = m_bindingPoint;
         WriteInfo.dstArrayElement = 0;
         WriteInfo.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
@@ -132,6 +143,42 @@ namespace gfx
 
         IsDirty = true;
     }
+    void GFXVulkanDescriptor::SetDynamicConstantBuffer(GFXBuffer* buffer, size_t range)
+    {
+        const auto vkBuffer = static_cast<GFXVulkanBuffer*>(buffer);
+
+        BufferFrameStride = vkBuffer->GetFrameOffset(1);
+        BufferInfo.buffer = vkBuffer->GetVkBuffer();
+        BufferInfo.offset = 0;
+        BufferInfo.range = range;
+
+        WriteInfo.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        WriteInfo.dstBinding = m_bindingPoint;
+        WriteInfo.dstArrayElement = 0;
+        WriteInfo.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        WriteInfo.descriptorCount = 1;
+        WriteInfo.pBufferInfo = &BufferInfo;
+
+        IsDirty = true;
+    }
+    void GFXVulkanDescriptor::SetDynamicStructuredBuffer(GFXBuffer* buffer, size_t range)
+    {
+        const auto vkBuffer = static_cast<GFXVulkanBuffer*>(buffer);
+
+        BufferFrameStride = vkBuffer->GetFrameOffset(1);
+        BufferInfo.buffer = vkBuffer->GetVkBuffer();
+        BufferInfo.offset = 0;
+        BufferInfo.range = range;
+
+        WriteInfo.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        WriteInfo.dstBinding = m_bindingPoint;
+        WriteInfo.dstArrayElement = 0;
+        WriteInfo.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+        WriteInfo.descriptorCount = 1;
+        WriteInfo.pBufferInfo = &BufferInfo;
+
+        IsDirty = true;
+    }
     void GFXVulkanDescriptor::SetTextureSampler2D(GFXTexture2DView* texture)
     {
         auto vkView = dynamic_cast<GFXVulkanTexture2DView*>(texture);
@@ -139,12 +186,12 @@ namespace gfx
         VkImageView imageView = vkView->GetVkImageView();
         VkSampler sampler = vkView->GetVkTexture()->GetVkSampler();
 
+        BufferFrameStride = 0;
         ImageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
         ImageInfo.imageView = imageView;
         ImageInfo.sampler = sampler;
 
         WriteInfo.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        WriteInfo.dstSet = m_descriptorSet->GetVkDescriptorSet();
         WriteInfo.dstBinding = m_bindingPoint;
         WriteInfo.dstArrayElement = 0;
         WriteInfo.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
@@ -166,12 +213,12 @@ namespace gfx
             assert(0);
         }
 
+        BufferFrameStride = 0;
         ImageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
         ImageInfo.imageView = imageView;
         ImageInfo.sampler = nullptr;
 
         WriteInfo.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        WriteInfo.dstSet = m_descriptorSet->GetVkDescriptorSet();
         WriteInfo.dstBinding = m_bindingPoint;
         WriteInfo.dstArrayElement = 0;
         WriteInfo.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
@@ -182,18 +229,22 @@ namespace gfx
     }
 
 
-    GFXVulkanDescriptorSet::GFXVulkanDescriptorSet(GFXVulkanDescriptorPool* pool, const GFXDescriptorSetLayout_sp& layout)
+    GFXVulkanDescriptorSet::GFXVulkanDescriptorSet(GFXVulkanDescriptorPool* pool, const GFXDescriptorSetLayout_sp& layout, uint32_t frameCount)
         : m_pool(pool)
     {
         m_setlayout = std::static_pointer_cast<GFXVulkanDescriptorSetLayout>(layout);
 
+        // one set per frame in flight, so a set can be rewritten while the gpu reads another frame's copy
+        std::vector<VkDescriptorSetLayout> layouts(frameCount, m_setlayout->GetVkDescriptorSetLayout());
+        m_descriptorSets.resize(frameCount);
+
         VkDescriptorSetAllocateInfo allocInfo{};
         allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
         allocInfo.descriptorPool = pool->GetVkDescriptorPool();
-        allocInfo.descriptorSetCount = 1;
-        allocInfo.pSetLayouts = &m_setlayout->GetVkDescriptorSetLayout();
+        allocInfo.descriptorSetCount = frameCount;
+        allocInfo.pSetLayouts = layouts.data();
 
-        const auto result = vkAllocateDescriptorSets(pool->GetApplication()->GetVkDevice(), &allocInfo, &m_descriptorSet);
+        const auto result = vkAllocateDescriptorSets(pool->GetApplication()->GetVkDevice(), &allocInfo, m_descriptorSets.data());
         assert(result == VK_SUCCESS);
     }
 
@@ -201,9 +252,16 @@ namespace gfx
     {
         m_descriptors.clear();
 
-        vkFreeDescriptorSets(this->GetApplication()->GetVkDevice(), m_pool->GetVkDescriptorPool(), 1, &m_descriptorSet);
-        m_descriptorSet = VK_NULL_HANDLE;
-        m_pool->ReleaseDescriptorSet();
+        const auto app = GetApplication();
+        if (auto frames = app->GetFrameResources())
+        {
+            frames->RemoveStale(this);
+        }
+
+        app->DeferDestroy([app, pool = m_pool, sets = std::move(m_descriptorSets)]() {
+            vkFreeDescriptorSets(app->GetVkDevice(), pool->GetVkDescriptorPool(), static_cast<uint32_t>(sets.size()), sets.data());
+            pool->ReleaseDescriptorSet(sets.size());
+        });
     }
 
     GFXDescriptor* GFXVulkanDescriptorSet::AddDescriptor(std::string_view name, uint32_t bindingPoint)
@@ -247,14 +305,54 @@ namespace gfx
     }
     void GFXVulkanDescriptorSet::Submit()
     {
-        std::vector<VkWriteDescriptorSet> writeInfos;
+        const auto frames = GetApplication()->GetFrameResources();
+
+        bool hasStale = false;
         for (const auto& descriptor : m_descriptors)
         {
             if (descriptor->IsDirty)
             {
-                writeInfos.push_back(descriptor->WriteInfo);
+                descriptor->StaleFrameMask = frames->GetAllFramesMask();
                 descriptor->IsDirty = false;
             }
+            hasStale |= descriptor->StaleFrameMask != 0;
+        }
+        if (!hasStale)
+        {
+            return;
+        }
+
+        // sets of frames in flight are written when their slot begins
+        if (!frames->IsRecording() || !UpdateFrame(frames->GetFrameIndex()))
+        {
+            frames->AddStale(this);
+        }
+    }
+    bool GFXVulkanDescriptorSet::UpdateFrame(uint32_t frameIndex)
+    {
+        const uint32_t frameBit = 1u << frameIndex;
+
+        std::vector<VkWriteDescriptorSet> writeInfos;
+        std::vector<VkDescriptorBufferInfo> bufferInfos;
+        writeInfos.reserve(m_descriptors.size());
+        bufferInfos.reserve(m_descriptors.size());
+
+        bool isUpToDate = true;
+        for (const auto& descriptor : m_descriptors)
+        {
+            if (descriptor->StaleFrameMask & frameBit)
+            {
+                auto& writeInfo = writeInfos.emplace_back(descriptor->WriteInfo);
+                writeInfo.dstSet = m_descriptorSets[frameIndex];
+                if (descriptor->BufferFrameStride != 0)
+                {
+                    auto& bufferInfo = bufferInfos.emplace_back(descriptor->BufferInfo);
+                    bufferInfo.offset += frameIndex * descriptor->BufferFrameStride;
+                    writeInfo.pBufferInfo = &bufferInfo;
+                }
+                descriptor->StaleFrameMask &= ~frameBit;
+            }
+            isUpToDate &= descriptor->StaleFrameMask == 0;
         }
         if (!writeInfos.empty())
         {
@@ -265,10 +363,15 @@ namespace gfx
                 0,
                 nullptr);
         }
+        return isUpToDate;
+    }
+    VkDescriptorSet GFXVulkanDescriptorSet::GetVkDescriptorSet() const
+    {
+        return m_descriptorSets[GetApplication()->GetFrameResources()->GetFrameIndex()];
     }
     intptr_t GFXVulkanDescriptorSet::GetId()
     {
-        return (intptr_t)m_descriptorSet;
+        return (intptr_t)m_descriptorSets[0];
     }
     GFXVulkanApplication* GFXVulkanDescriptorSet::GetApplication() const
     {
@@ -0,0 +1,79 @@
+#include <gfx-vk/GFXVulkanDynamicBuffer.h>
+#include <gfx-vk/GFXVulkanApplication.h>
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+namespace gfx
+{
+    static size_t _AlignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    GFXVulkanDynamicBuffer::GFXVulkanDynamicBuffer(GFXVulkanApplication* app, size_t frameCapacity, size_t maxBindingRange, uint32_t frameCount)
+        : m_app(app), m_maxBindingRange(maxBindingRange), m_frameCount(frameCount)
+    {
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(app->GetVkPhysicalDevice(), &properties);
+        m_alignment = std::max(
+            properties.limits.minUniformBufferOffsetAlignment,
+            properties.limits.minStorageBufferOffsetAlignment);
+
+        m_frameCapacity = _AlignUp(frameCapacity, m_alignment);
+        CreateBuffer();
+    }
+
+    void GFXVulkanDynamicBuffer::CreateBuffer()
+    {
+        m_buffer.reset();
+        // the tail keeps offset + range inside the buffer for allocations at the end of the last slot
+        const auto bufferSize = m_frameCapacity * m_frameCount + m_maxBindingRange;
+        m_buffer = std::make_unique<GFXVulkanBuffer>(
+            m_app, GFXBufferUsage::ConstantBuffer, bufferSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        m_mappedData = static_cast<uint8_t*>(m_buffer->Map());
+    }
+
+    GFXVulkanDynamicBuffer::~GFXVulkanDynamicBuffer()
+    {
+        m_buffer.reset();
+        m_mappedData = nullptr;
+    }
+
+    GFXDynamicBufferAllocation GFXVulkanDynamicBuffer::Allocate(size_t size)
+    {
+        // allocations keep the used size aligned, so recording threads only need one atomic add
+        const auto alignedSize = _AlignUp(size, m_alignment);
+        const auto offset = m_frameUsedSize.fetch_add(alignedSize, std::memory_order_relaxed);
+        if (offset + size > m_frameCapacity)
+        {
+            throw std::runtime_error("dynamic buffer is out of frame memory, the frame was not reserved!");
+        }
+
+        const auto bufferOffset = m_frameIndex * m_frameCapacity + offset;
+        return GFXDynamicBufferAllocation{m_mappedData + bufferOffset, static_cast<uint32_t>(bufferOffset), size};
+    }
+
+    void GFXVulkanDynamicBuffer::Reserve(size_t allocationCount, size_t allocationSize)
+    {
+        const auto required = allocationCount * _AlignUp(allocationSize, m_alignment);
+        if (required <= m_frameCapacity)
+        {
+            return;
+        }
+        assert(m_frameUsedSize == 0);
+
+        // the other frame slots may still be read by the gpu
+        vkDeviceWaitIdle(m_app->GetVkDevice());
+        // doubled at least, so a slowly growing scene does not stall every frame
+        m_frameCapacity = _AlignUp(std::max(required, m_frameCapacity * 2), m_alignment);
+        CreateBuffer();
+    }
+
+    void GFXVulkanDynamicBuffer::BeginFrame(uint32_t frameIndex)
+    {
+        assert(frameIndex < m_frameCount);
+        m_frameIndex = frameIndex;
+        m_frameUsedSize = 0;
+    }
+}
@@ -57,7 +57,10 @@ namespace gfx
 
     void GFXVulkanFrameBufferObject::TermRenderPass()
     {
-        vkDestroyFramebuffer(m_app->GetVkDevice(), m_frameBuffer, nullptr);
+        // keeps the render pass alive until frames recorded with it have retired
+        m_app->DeferDestroy([app = m_app, frameBuffer = m_frameBuffer, renderPass = std::move(m_renderPass)]() {
+            vkDestroyFramebuffer(app->GetVkDevice(), frameBuffer, nullptr);
+        });
         m_frameBuffer = VK_NULL_HANDLE;
         m_renderPass.reset();
     }
@@ -0,0 +1,90 @@
+#include <gfx-vk/GFXVulkanFrameResources.h>
+#include <gfx-vk/GFXVulkanBuffer.h>
+#include <gfx-vk/GFXVulkanDescriptorSet.h>
+#include <cassert>
+
+namespace gfx
+{
+    GFXVulkanFrameResources::GFXVulkanFrameResources(uint32_t frameCount)
+        : m_frameCount(frameCount)
+    {
+        assert(frameCount > 0 && frameCount <= 32);
+        m_deferred.resize(frameCount);
+    }
+
+    GFXVulkanFrameResources::~GFXVulkanFrameResources()
+    {
+        FlushDeferred();
+    }
+
+    void GFXVulkanFrameResources::RunDestroyers(std::vector<std::function<void()>>& destroyers)
+    {
+        for (auto& destroyer : destroyers)
+        {
+            destroyer();
+        }
+    }
+
+    void GFXVulkanFrameResources::BeginFrame(uint32_t frameIndex)
+    {
+        assert(frameIndex < m_frameCount);
+        m_frameIndex = frameIndex;
+
+        std::vector<std::function<void()>> destroyers;
+        {
+            std::lock_guard lock{m_deferredMutex};
+            destroyers.swap(m_deferred[frameIndex]);
+        }
+        RunDestroyers(destroyers);
+
+        for (auto it = m_staleBuffers.begin(); it != m_staleBuffers.end();)
+        {
+            if ((*it)->UpdateFrame(frameIndex))
+                it = m_staleBuffers.erase(it);
+            else
+                ++it;
+        }
+        for (auto it = m_staleDescriptorSets.begin(); it != m_staleDescriptorSets.end();)
+        {
+            if ((*it)->UpdateFrame(frameIndex))
+                it = m_staleDescriptorSets.erase(it);
+            else
+                ++it;
+        }
+
+        m_isRecording = true;
+    }
+
+    void GFXVulkanFrameResources::EndFrame()
+    {
+        m_isRecording = false;
+    }
+
+    void GFXVulkanFrameResources::DeferDestroy(std::function<void()>&& destroyer)
+    {
+        std::lock_guard lock{m_deferredMutex};
+        m_deferred[m_frameIndex].push_back(std::move(destroyer));
+    }
+
+    void GFXVulkanFrameResources::FlushDeferred()
+    {
+        bool hasPending = true;
+        while (hasPending)
+        {
+            hasPending = false;
+            for (auto& slot : m_deferred)
+            {
+                std::vector<std::function<void()>> destroyers;
+                {
+                    std::lock_guard lock{m_deferredMutex};
+                    destroyers.swap(slot);
+                }
+                if (!destroyers.empty())
+                {
+                    RunDestroyers(destroyers);
+                    hasPending = true;
+                }
+            }
+        }
+    }
+}
@@ -78,7 +78,8 @@ namespace gfx
         const std::shared_ptr<GFXShaderPass>& shaderPass,
         const array_list<GFXDescriptorSetLayout_sp>& descriptorSetLayouts,
         const GFXRenderPassLayout& renderLayout,
-        const GFXGraphicsPipelineState& gpInfo)
+        const GFXGraphicsPipelineState& gpInfo,
+        VkPipelineCache pipelineCache)
         : m_app(app)
     {
         // create pipeline layout
@@ -210,7 +211,7 @@ namespace gfx
         pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
         pipelineInfo.pDepthStencilState = &depthStencil;
 
-        if (vkCreateGraphicsPipelines(app->GetVkDevice(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_pipeline) != VK_SUCCESS)
+        if (vkCreateGraphicsPipelines(app->GetVkDevice(), pipelineCache, 1, &pipelineInfo, nullptr, &m_pipeline) != VK_SUCCESS)
         {
             throw std::runtime_error("failed to create graphics pipeline!");
         }
@@ -218,7 +219,10 @@ namespace gfx
 
     GFXVulkanGraphicsPipeline::~GFXVulkanGraphicsPipeline()
     {
-        vkDestroyPipelineLayout(m_app->GetVkDevice(), m_pipelineLayout, nullptr);
-        vkDestroyPipeline(m_app->GetVkDevice(), m_pipeline, nullptr);
+        // evicted pipelines may still be used by frames in flight
+        m_app->DeferDestroy([device = m_app->GetVkDevice(), layout = m_pipelineLayout, pipeline = m_pipeline]() {
+            vkDestroyPipelineLayout(device, layout, nullptr);
+            vkDestroyPipeline(device, pipeline, nullptr);
+        });
     }
 } // namespace gfx
\ No newline at end of file
@@ -1,24 +1,25 @@
 #include "GFXVulkanGraphicsPipelineManager.h"
+#include "GFXVulkanApplication.h"
 #include "GFXVulkanGraphicsPipeline.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
 
 namespace gfx
 {
-    GFXVulkanGraphicsPipelineManager::~GFXVulkanGraphicsPipelineManager()
-    {
-
-    }
     GFXVulkanGraphicsPipelineManager::GFXVulkanGraphicsPipelineManager(GFXVulkanApplication* app)
         : m_app(app)
     {
-
+        LoadPipelineCache();
     }
 
-
-    inline intptr_t HashPointer2(void* p, void* q)
+    GFXVulkanGraphicsPipelineManager::~GFXVulkanGraphicsPipelineManager()
     {
-        constexpr intptr_t HashS0 = 2166136261;
-        constexpr intptr_t HashS1 = 16777619;
-        return ((HashS0 * HashS1) ^ (intptr_t)p) * HashS1 ^ (intptr_t)q;
+        SavePipelineCache();
+        m_caches.clear();
+        vkDestroyPipelineCache(m_app->GetVkDevice(), m_pipelineCache, nullptr);
     }
 
     std::shared_ptr<GFXGraphicsPipeline> GFXVulkanGraphicsPipelineManager::GetGraphicsPipeline(
@@ -27,22 +28,140 @@ namespace gfx
         const std::shared_ptr<GFXRenderPassLayout>& renderPass,
         const GFXGraphicsPipelineState& gpInfo)
     {
-        auto hash = (HashPointer2(shaderPass.get(), renderPass.get()) ^ gpInfo.GetHashCode()) * 16777619;
+        const auto key = GFXGraphicsPipelineKey::Make(shaderPass.get(), descriptorSetLayouts, *renderPass, gpInfo);
 
-        auto v = m_caches.find(hash);
-        if (v != m_caches.end())
         {
-            return v->second;
+            std::lock_guard lock{m_mutex};
+            auto it = m_caches.find(key);
+            if (it != m_caches.end() && it->second.ShaderPass.lock() == shaderPass)
+            {
+                it->second.LastUsedFrame = m_frame;
+                return it->second.Pipeline;
+            }
         }
-        auto pipeline = new GFXVulkanGraphicsPipeline(m_app, shaderPass, descriptorSetLayouts, *renderPass, gpInfo);
-        auto gpipeline = gfxmksptr(pipeline);
 
-        m_caches.insert({ hash, gpipeline });
+        // compiled outside the lock so other threads keep recording, VkPipelineCache is internally synchronized
+        auto gpipeline = gfxmksptr(new GFXVulkanGraphicsPipeline(m_app, shaderPass, descriptorSetLayouts, *renderPass, gpInfo, m_pipelineCache));
+
+        std::lock_guard lock{m_mutex};
+        auto& entry = m_caches[key];
+        if (entry.Pipeline && entry.ShaderPass.lock() == shaderPass)
+        {
+            // another thread built the same pipeline meanwhile
+            entry.LastUsedFrame = m_frame;
+            return entry.Pipeline;
+        }
+        entry.ShaderPass = shaderPass;
+        entry.Pipeline = gpipeline;
+        entry.LastUsedFrame = m_frame;
         return gpipeline;
     }
 
     void GFXVulkanGraphicsPipelineManager::GCollect()
     {
+        std::lock_guard lock{m_mutex};
+        ++m_frame;
+
+        std::erase_if(m_caches, [](const auto& item) { return item.second.ShaderPass.expired(); });
+
+        if (m_caches.size() <= kMaxCachedPipelines)
+        {
+            return;
+        }
+
+        array_list<std::pair<uint64_t, GFXGraphicsPipelineKey>> candidates;
+        for (const auto& [key, entry] : m_caches)
+        {
+            if (m_frame - entry.LastUsedFrame >= kMinUnusedFrames)
+            {
+                candidates.emplace_back(entry.LastUsedFrame, key);
+            }
+        }
+        std::ranges::sort(candidates, {}, &std::pair<uint64_t, GFXGraphicsPipelineKey>::first);
+
+        for (const auto& candidate : candidates)
+        {
+            if (m_caches.size() <= kMaxCachedPipelines)
+            {
+                break;
+            }
+            m_caches.erase(candidate.second);
+        }
+    }
+
+    void GFXVulkanGraphicsPipelineManager::LoadPipelineCache()
+    {
+        const auto path = std::filesystem::path{m_app->GetConfig().PipelineCachePath};
+
+        std::vector<char> data;
+        if (!path.empty() && std::filesystem::exists(path))
+        {
+            std::ifstream file{path, std::ios::binary};
+            data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+
+        // data written by another driver or device is ignored
+        if (data.size() >= sizeof(VkPipelineCacheHeaderVersionOne))
+        {
+            VkPipelineCacheHeaderVersionOne header{};
+            std::memcpy(&header, data.data(), sizeof(header));
+
+            const auto& properties = m_app->GetVkPhysicalDeviceProperties();
+            if (header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+                header.vendorID != properties.vendorID ||
+                header.deviceID != properties.deviceID ||
+                std::memcmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+            {
+                data.clear();
+            }
+        }
+        else
+        {
+            data.clear();
+        }
+
+        VkPipelineCacheCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        createInfo.initialDataSize = data.size();
+        createInfo.pInitialData = data.empty() ? nullptr : data.data();
+
+        if (vkCreatePipelineCache(m_app->GetVkDevice(), &createInfo, nullptr, &m_pipelineCache) != VK_SUCCESS)
+        {
+            throw std::runtime_error("failed to create pipeline cache!");
+        }
+    }
+
+    void GFXVulkanGraphicsPipelineManager::SavePipelineCache()
+    {
+        const auto path = std::filesystem::path{m_app->GetConfig().PipelineCachePath};
+        if (path.empty())
+        {
+            return;
+        }
+
+        size_t size{};
+        if (vkGetPipelineCacheData(m_app->GetVkDevice(), m_pipelineCache, &size, nullptr) != VK_SUCCESS || size == 0)
+        {
+            return;
+        }
+        std::vector<char> data(size);
+        if (vkGetPipelineCacheData(m_app->GetVkDevice(), m_pipelineCache, &size, data.data()) != VK_SUCCESS)
+        {
+            return;
+        }
 
+        // written aside first, a crash while saving must not leave a truncated cache
+        auto tempPath = path;
+        tempPath += ".tmp";
+        {
+            std::ofstream file{tempPath, std::ios::binary | std::ios::trunc};
+            if (!file)
+            {
+                return;
+            }
+            file.write(data.data(), static_cast<std::streamsize>(size));
+        }
+        std::error_code err;
+        std::filesystem::rename(tempPath, path, err);
     }
 }
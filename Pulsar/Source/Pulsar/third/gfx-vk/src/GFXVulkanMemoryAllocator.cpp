@@ -0,0 +1,246 @@
+#include <gfx-vk/GFXVulkanMemoryAllocator.h>
+#include <gfx-vk/GFXVulkanApplication.h>
+#include <algorithm>
+#include <cassert>
+#include <ranges>
+#include <stdexcept>
+
+namespace gfx
+{
+    static constexpr VkDeviceSize kDeviceLocalBlockSize = 64 * 1024 * 1024;
+    static constexpr VkDeviceSize kHostVisibleBlockSize = 16 * 1024 * 1024;
+
+    static VkDeviceSize _AlignUp(VkDeviceSize value, VkDeviceSize alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    bool GFXVulkanMemoryBlock::TryAllocate(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* outOffset)
+    {
+        for (auto it = FreeRanges.begin(); it != FreeRanges.end(); ++it)
+        {
+            const auto [rangeOffset, rangeSize] = *it;
+            const auto offset = _AlignUp(rangeOffset, alignment);
+            const auto padding = offset - rangeOffset;
+            if (padding + size > rangeSize)
+            {
+                continue;
+            }
+
+            FreeRanges.erase(it);
+            if (padding > 0)
+            {
+                FreeRanges.emplace(rangeOffset, padding);
+            }
+            if (const auto remain = rangeSize - padding - size; remain > 0)
+            {
+                FreeRanges.emplace(offset + size, remain);
+            }
+
+            UsedSize += size;
+            ++AllocationCount;
+            *outOffset = offset;
+            return true;
+        }
+        return false;
+    }
+
+    void GFXVulkanMemoryBlock::Free(VkDeviceSize offset, VkDeviceSize size)
+    {
+        UsedSize -= size;
+        --AllocationCount;
+
+        auto it = FreeRanges.emplace(offset, size).first;
+
+        // merge with the next range
+        if (auto next = std::next(it); next != FreeRanges.end() && offset + size == next->first)
+        {
+            it->second += next->second;
+            FreeRanges.erase(next);
+        }
+        // merge with the previous range
+        if (it != FreeRanges.begin())
+        {
+            auto prev = std::prev(it);
+            if (prev->first + prev->second == it->first)
+            {
+                prev->second += it->second;
+                FreeRanges.erase(it);
+            }
+        }
+    }
+
+    GFXVulkanMemoryAllocator::GFXVulkanMemoryAllocator(GFXVulkanApplication* app)
+        : m_app(app)
+    {
+        vkGetPhysicalDeviceMemoryProperties(app->GetVkPhysicalDevice(), &m_memoryProperties);
+    }
+
+    GFXVulkanMemoryAllocator::~GFXVulkanMemoryAllocator()
+    {
+        for (auto& blocks : m_blocks)
+        {
+            for (auto& block : blocks)
+            {
+                DestroyBlock(block.get());
+            }
+            blocks.clear();
+        }
+    }
+
+    uint32_t GFXVulkanMemoryAllocator::FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const
+    {
+        for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; i++)
+        {
+            if ((typeFilter & (1 << i)) &&
+                (m_memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+            {
+                return i;
+            }
+        }
+
+        throw std::runtime_error("failed to find suitable memory type!");
+    }
+
+    GFXVulkanMemoryAllocation GFXVulkanMemoryAllocator::Allocate(
+        const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties, bool isLinear)
+    {
+        const auto memoryType = FindMemoryType(requirements.memoryTypeBits, properties);
+        const auto alignment = std::max<VkDeviceSize>(requirements.alignment, 1);
+
+        std::lock_guard lock{m_mutex};
+
+        auto& blocks = m_blocks[memoryType * 2 + (isLinear ? 0 : 1)];
+
+        GFXVulkanMemoryBlock* block = nullptr;
+        VkDeviceSize offset{};
+        for (auto& item : blocks)
+        {
+            if (item->Size - item->UsedSize >= requirements.size && item->TryAllocate(requirements.size, alignment, &offset))
+            {
+                block = item.get();
+                break;
+            }
+        }
+
+        if (!block)
+        {
+            // large resources get a block of their own
+            const auto preferredSize = GetPreferredBlockSize(memoryType);
+            const bool isDedicated = requirements.size > preferredSize / 2;
+            block = CreateBlock(memoryType, isDedicated ? requirements.size : preferredSize, isLinear);
+            block->IsDedicated = isDedicated;
+            blocks.emplace_back(block);
+
+            const bool isAllocated = block->TryAllocate(requirements.size, alignment, &offset);
+            assert(isAllocated);
+        }
+
+        GFXVulkanMemoryAllocation allocation;
+        allocation.Memory = block->Memory;
+        allocation.Offset = offset;
+        allocation.Size = requirements.size;
+        allocation.MappedData = block->MappedData ? block->MappedData + offset : nullptr;
+        allocation.Block = block;
+        return allocation;
+    }
+
+    void GFXVulkanMemoryAllocator::Free(GFXVulkanMemoryAllocation& allocation)
+    {
+        if (!allocation.IsValid())
+        {
+            return;
+        }
+
+        std::lock_guard lock{m_mutex};
+
+        auto block = allocation.Block;
+        block->Free(allocation.Offset, allocation.Size);
+        allocation = {};
+
+        if (block->AllocationCount != 0)
+        {
+            return;
+        }
+
+        // keep one empty block per list around to avoid churn
+        auto& blocks = m_blocks[block->MemoryType * 2 + (block->IsLinear ? 0 : 1)];
+        if (block->IsDedicated || blocks.size() > 1)
+        {
+            auto it = std::ranges::find_if(blocks, [block](const auto& item) { return item.get() == block; });
+            DestroyBlock(block);
+            blocks.erase(it);
+        }
+    }
+
+    GFXMemoryStatistics GFXVulkanMemoryAllocator::GetStatistics() const
+    {
+        std::lock_guard lock{m_mutex};
+
+        GFXMemoryStatistics stats{};
+        for (auto& blocks : m_blocks)
+        {
+            for (auto& block : blocks)
+            {
+                ++stats.BlockCount;
+                stats.AllocationCount += block->AllocationCount;
+                stats.ReservedSize += block->Size;
+                stats.UsedSize += block->UsedSize;
+                stats.FreeRangeCount += block->FreeRanges.size();
+                for (const auto size : block->FreeRanges | std::views::values)
+                {
+                    stats.LargestFreeRange = std::max<uint64_t>(stats.LargestFreeRange, size);
+                }
+            }
+        }
+        return stats;
+    }
+
+    GFXVulkanMemoryBlock* GFXVulkanMemoryAllocator::CreateBlock(uint32_t memoryType, VkDeviceSize size, bool isLinear)
+    {
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = size;
+        allocInfo.memoryTypeIndex = memoryType;
+
+        auto block = new GFXVulkanMemoryBlock;
+        if (vkAllocateMemory(m_app->GetVkDevice(), &allocInfo, nullptr, &block->Memory) != VK_SUCCESS)
+        {
+            delete block;
+            throw std::runtime_error("failed to allocate device memory!");
+        }
+        block->Size = size;
+        block->MemoryType = memoryType;
+        block->IsLinear = isLinear;
+        block->FreeRanges.emplace(0, size);
+
+        if (m_memoryProperties.memoryTypes[memoryType].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+        {
+            void* data;
+            vkMapMemory(m_app->GetVkDevice(), block->Memory, 0, VK_WHOLE_SIZE, 0, &data);
+            block->MappedData = static_cast<uint8_t*>(data);
+        }
+        return block;
+    }
+
+    void GFXVulkanMemoryAllocator::DestroyBlock(GFXVulkanMemoryBlock* block)
+    {
+        if (block->MappedData)
+        {
+            vkUnmapMemory(m_app->GetVkDevice(), block->Memory);
+            block->MappedData = nullptr;
+        }
+        vkFreeMemory(m_app->GetVkDevice(), block->Memory, nullptr);
+        block->Memory = VK_NULL_HANDLE;
+    }
+
+    VkDeviceSize GFXVulkanMemoryAllocator::GetPreferredBlockSize(uint32_t memoryType) const
+    {
+        const auto flags = m_memoryProperties.memoryTypes[memoryType].propertyFlags;
+        if (flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+        {
+            return kHostVisibleBlockSize;
+        }
+        return kDeviceLocalBlockSize;
+    }
+}
@@ -57,7 +57,11 @@ namespace gfx
         vkBuffers.reserve(count);
         for (size_t i = 0; i < count; i++)
         {
-            vkBuffers.push_back(buffers[i].GetVkCommandBuffer());
+            // buffers that were never begun have nothing to execute
+            if (buffers[i].GetVkCommandBuffer() != VK_NULL_HANDLE)
+            {
+                vkBuffers.push_back(buffers[i].GetVkCommandBuffer());
+            }
         }
 
         Internal_Submit(vkBuffers.data(), vkBuffers.size());
@@ -56,6 +56,8 @@ namespace gfx
 
             auto rtType = rt->GetTargetType();
 
+            m_compatibilityKey.push_back(uint64_t(imageFormat) << 32 | uint64_t(attachment.samples) << 8 | uint64_t(rtType));
+
             if (rtType == GFXTextureTargetType::ColorTarget)
             {
                 colorAttachmentRef.push_back(ref);
@@ -2,7 +2,10 @@
 #include "GFXVulkanApplication.h"
 #include "GFXVulkanRenderPass.h"
 #include "GFXVulkanCommandBuffer.h"
+#include "GFXVulkanDynamicBuffer.h"
+#include "GFXVulkanFrameResources.h"
 #include "GFXVulkanQueue.h"
+#include "GFXVulkanUploadManager.h"
 #include "GFXVulkanFrameBufferObject.h"
 #include <array>
 
@@ -17,7 +20,9 @@ namespace gfx
     void GFXVulkanRenderer::Render(float deltaTime)
     {
         const auto viewport = m_app->GetVulkanViewport();
+        const auto frameIndex = viewport->NextFrame();
 
+        // only wait for the frame that used this slot, the newer frames keep running
         vkWaitForFences(m_app->GetVkDevice(), 1, &viewport->GetQueue()->GetVkFence(), VK_TRUE, UINT64_MAX);
 
         uint32_t imageIndex;
@@ -34,6 +39,10 @@ namespace gfx
 
         vkResetFences(m_app->GetVkDevice(), 1, &viewport->GetQueue()->GetVkFence());
 
+        m_app->GetFrameResources()->BeginFrame(frameIndex);
+        m_app->GetVulkanDynamicBuffer()->BeginFrame(frameIndex);
+        m_app->GetUploadManager()->Retire();
+
         GFXVulkanRenderContext renderContext(m_app);
 
         renderContext.SetQueue(viewport->GetQueue());
@@ -41,7 +50,12 @@ namespace gfx
 
         const auto renderTargets = viewport->GetFrameBufferObject();
         m_app->GetRenderPipeline()->OnRender(&renderContext, renderTargets);
+
+        // uploads recorded since the last frame go to the queue ahead of the frame that reads them
+        m_app->GetUploadManager()->Flush();
         renderContext.Submit();
+        m_app->GetFrameResources()->EndFrame();
+        m_app->GetGraphicsPipelineManager()->GCollect();
 
         VkPresentInfoKHR presentInfo{};
         presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
@@ -54,7 +68,6 @@ namespace gfx
         presentInfo.pImageIndices = &imageIndex;
 
         result = vkQueuePresentKHR(m_app->GetVkPresentQueue(), &presentInfo);
-        vkQueueWaitIdle(m_app->GetVkPresentQueue());
 
         if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || m_framebufferResized)
         {
@@ -16,13 +16,16 @@ namespace gfx
     {
         if (m_inited)
         {
-            if (!m_isView)
-            {
-                vkDestroyImage(m_app->GetVkDevice(), m_textureImage, nullptr);
-                vkFreeMemory(m_app->GetVkDevice(), m_textureImageMemory, nullptr);
-                vkDestroyImageView(m_app->GetVkDevice(), m_textureImageView, nullptr);
-            }
-            vkDestroySampler(m_app->GetVkDevice(), m_textureSampler, nullptr);
+            m_app->DeferDestroy([app = m_app, isView = m_isView, image = m_textureImage, memory = m_textureImageMemory,
+                view = m_textureImageView, sampler = m_textureSampler]() mutable {
+                if (!isView)
+                {
+                    vkDestroyImage(app->GetVkDevice(), image, nullptr);
+                    app->GetMemoryAllocator()->Free(memory);
+                    vkDestroyImageView(app->GetVkDevice(), view, nullptr);
+                }
+                vkDestroySampler(app->GetVkDevice(), sampler, nullptr);
+            });
         }
     }
 
@@ -69,7 +72,7 @@ namespace gfx
             currentLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
 
             VkBuffer stagingBuffer;
-            VkDeviceMemory stagingBufferMemory;
+            GFXVulkanMemoryAllocation stagingBufferMemory;
             VkDeviceSize imageSize = info.dataLength;
 
             auto stagingProperties = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
@@ -77,14 +80,10 @@ namespace gfx
             gfx::BufferHelper::CreateBuffer(app, imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
                                             stagingProperties, stagingBuffer, stagingBufferMemory);
 
-            void* data;
-            vkMapMemory(app->GetVkDevice(), stagingBufferMemory, 0, imageSize, 0, &data);
-            memcpy(data, info.imageData, static_cast<size_t>(imageSize));
-            vkUnmapMemory(app->GetVkDevice(), stagingBufferMemory);
+            memcpy(stagingBufferMemory.MappedData, info.imageData, static_cast<size_t>(imageSize));
             BufferHelper::CopyBufferToImage(app, stagingBuffer, m_textureImage, m_width, m_height);
 
-            vkDestroyBuffer(app->GetVkDevice(), stagingBuffer, nullptr);
-            vkFreeMemory(app->GetVkDevice(), stagingBufferMemory, nullptr);
+            BufferHelper::DestroyBuffer(app, stagingBuffer, stagingBufferMemory);
         }
 
         m_targetFinalLayout = GetFinalImageLayout(m_targetType);
@@ -106,7 +105,7 @@ namespace gfx
     GFXVulkanTexture::GFXVulkanTexture(
         GFXVulkanApplication* app, const GFXVulkanTextureProxyCreateInfo& info)
         : base(info.width, info.height, 1, {}),
-          m_app(app), m_textureImage(info.image), m_textureImageMemory(VK_NULL_HANDLE), m_imageFormat(info.format),
+          m_app(app), m_textureImage(info.image), m_textureImageMemory(), m_imageFormat(info.format),
           m_imageLayout(info.layout), m_targetType(info.usage), m_isView(true), m_targetFinalLayout(info.finalTargetLayout),
         m_dataType(info.dataType)
     {
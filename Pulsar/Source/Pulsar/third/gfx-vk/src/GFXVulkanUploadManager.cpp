@@ -0,0 +1,274 @@
+#include <gfx-vk/GFXVulkanUploadManager.h>
+#include <gfx-vk/GFXVulkanApplication.h>
+#include <gfx-vk/GFXVulkanCommandBufferPool.h>
+#include <gfx-vk/BufferHelper.h>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+namespace gfx
+{
+    static constexpr VkDeviceSize kStagingAlignment = 16;
+
+    static VkDeviceSize _AlignUp(VkDeviceSize value, VkDeviceSize alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    GFXVulkanUploadManager::GFXVulkanUploadManager(GFXVulkanApplication* app, VkDeviceSize stagingSize)
+        : m_app(app), m_stagingSize(_AlignUp(stagingSize, kStagingAlignment))
+    {
+        BufferHelper::CreateBuffer(m_app, m_stagingSize,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            m_stagingBuffer, m_stagingMemory);
+    }
+
+    GFXVulkanUploadManager::~GFXVulkanUploadManager()
+    {
+        WaitIdle();
+        for (auto fence : m_freeFences)
+        {
+            vkDestroyFence(m_app->GetVkDevice(), fence, nullptr);
+        }
+        BufferHelper::DestroyBuffer(m_app, m_stagingBuffer, m_stagingMemory);
+    }
+
+    bool GFXVulkanUploadManager::TryAllocateStaging(VkDeviceSize size, VkDeviceSize& offset)
+    {
+        if (m_stagingUsed == 0)
+        {
+            m_stagingHead = m_stagingTail = 0;
+        }
+
+        const bool isFull = m_stagingUsed != 0 && m_stagingHead == m_stagingTail;
+        VkDeviceSize wasted = 0;
+        if (m_stagingHead >= m_stagingTail && !isFull)
+        {
+            if (m_stagingHead + size <= m_stagingSize)
+            {
+                offset = m_stagingHead;
+            }
+            else
+            {
+                // skip the end of the ring and wrap around
+                if (size > m_stagingTail)
+                {
+                    return false;
+                }
+                wasted = m_stagingSize - m_stagingHead;
+                offset = 0;
+            }
+        }
+        else
+        {
+            if (m_stagingHead + size > m_stagingTail)
+            {
+                return false;
+            }
+            offset = m_stagingHead;
+        }
+
+        m_stagingHead = offset + size;
+        m_stagingUsed += wasted + size;
+        m_recordingConsumed += wasted + size;
+        return true;
+    }
+
+    VkCommandBuffer GFXVulkanUploadManager::GetRecordingCommandBuffer()
+    {
+        if (m_recordingCmd)
+        {
+            return m_recordingCmd;
+        }
+
+        m_recordingCmd = m_app->GetCommandBufferPool()->GetVkCommandBuffer();
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        if (vkBeginCommandBuffer(m_recordingCmd, &beginInfo) != VK_SUCCESS)
+        {
+            throw std::runtime_error("failed to begin upload command buffer!");
+        }
+
+        // destination buffers may still be read by earlier submissions
+        vkCmdPipelineBarrier(m_recordingCmd,
+            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+            0, 0, nullptr, 0, nullptr, 0, nullptr);
+
+        return m_recordingCmd;
+    }
+
+    VkFence GFXVulkanUploadManager::AcquireFence()
+    {
+        if (!m_freeFences.empty())
+        {
+            auto fence = m_freeFences.back();
+            m_freeFences.pop_back();
+            return fence;
+        }
+
+        VkFenceCreateInfo info{};
+        info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        VkFence fence;
+        if (vkCreateFence(m_app->GetVkDevice(), &info, nullptr, &fence) != VK_SUCCESS)
+        {
+            throw std::runtime_error("failed to create upload fence!");
+        }
+        return fence;
+    }
+
+    uint64_t GFXVulkanUploadManager::UploadBuffer(VkBuffer dest, VkDeviceSize destOffset, const void* data, VkDeviceSize size)
+    {
+        assert(size > 0);
+
+        VkBuffer srcBuffer;
+        VkDeviceSize srcOffset = 0;
+
+        const auto alignedSize = _AlignUp(size, kStagingAlignment);
+        if (alignedSize > m_stagingSize / 2)
+        {
+            // too large for the ring, use a staging buffer that lives until the submission retires
+            TemporaryStaging staging;
+            BufferHelper::CreateBuffer(m_app, size,
+                VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                staging.Buffer, staging.Memory);
+            memcpy(staging.Memory.MappedData, data, size);
+            srcBuffer = staging.Buffer;
+            m_recordingTemporaries.push_back(staging);
+        }
+        else
+        {
+            while (!TryAllocateStaging(alignedSize, srcOffset))
+            {
+                if (m_submissions.empty())
+                {
+                    // only the recording batch holds the ring, hand it to the gpu first
+                    Flush();
+                }
+                assert(!m_submissions.empty());
+                vkWaitForFences(m_app->GetVkDevice(), 1, &m_submissions.front().Fence, VK_TRUE, UINT64_MAX);
+                RetireFront();
+            }
+            memcpy(static_cast<uint8_t*>(m_stagingMemory.MappedData) + srcOffset, data, size);
+            srcBuffer = m_stagingBuffer;
+        }
+
+        VkBufferCopy region{};
+        region.srcOffset = srcOffset;
+        region.dstOffset = destOffset;
+        region.size = size;
+        vkCmdCopyBuffer(GetRecordingCommandBuffer(), srcBuffer, dest, 1, &region);
+        ++m_recordingCopyCount;
+
+        return m_recordingId;
+    }
+
+    void GFXVulkanUploadManager::Flush()
+    {
+        if (!m_recordingCmd)
+        {
+            return;
+        }
+
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
+            VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(m_recordingCmd,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+            0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+        if (vkEndCommandBuffer(m_recordingCmd) != VK_SUCCESS)
+        {
+            throw std::runtime_error("failed to record upload command buffer!");
+        }
+
+        auto fence = AcquireFence();
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &m_recordingCmd;
+        if (vkQueueSubmit(m_app->GetVkGraphicsQueue(), 1, &submitInfo, fence) != VK_SUCCESS)
+        {
+            throw std::runtime_error("failed to submit upload command buffer!");
+        }
+
+        Submission submission;
+        submission.Id = m_recordingId;
+        submission.Fence = fence;
+        submission.Cmd = m_recordingCmd;
+        submission.StagingConsumed = m_recordingConsumed;
+        submission.Temporaries = std::move(m_recordingTemporaries);
+        m_submissions.push_back(std::move(submission));
+
+        m_recordingCmd = VK_NULL_HANDLE;
+        m_recordingConsumed = 0;
+        m_recordingCopyCount = 0;
+        m_recordingTemporaries.clear();
+        ++m_recordingId;
+    }
+
+    void GFXVulkanUploadManager::RetireFront()
+    {
+        auto& submission = m_submissions.front();
+
+        vkResetFences(m_app->GetVkDevice(), 1, &submission.Fence);
+        m_freeFences.push_back(submission.Fence);
+        m_app->GetCommandBufferPool()->ReleaseCommandBuffer(submission.Cmd);
+
+        for (auto& staging : submission.Temporaries)
+        {
+            BufferHelper::DestroyBuffer(m_app, staging.Buffer, staging.Memory);
+        }
+
+        // submissions retire in order, so the tail simply follows them around the ring
+        m_stagingTail = (m_stagingTail + submission.StagingConsumed) % m_stagingSize;
+        m_stagingUsed -= submission.StagingConsumed;
+        m_retiredId = submission.Id;
+
+        m_submissions.pop_front();
+    }
+
+    void GFXVulkanUploadManager::Retire()
+    {
+        while (!m_submissions.empty() &&
+            vkGetFenceStatus(m_app->GetVkDevice(), m_submissions.front().Fence) == VK_SUCCESS)
+        {
+            RetireFront();
+        }
+    }
+
+    void GFXVulkanUploadManager::WaitFor(uint64_t uploadId)
+    {
+        if (IsRetired(uploadId))
+        {
+            return;
+        }
+        if (uploadId >= m_recordingId)
+        {
+            Flush();
+        }
+        while (!m_submissions.empty() && !IsRetired(uploadId))
+        {
+            vkWaitForFences(m_app->GetVkDevice(), 1, &m_submissions.front().Fence, VK_TRUE, UINT64_MAX);
+            RetireFront();
+        }
+    }
+
+    void GFXVulkanUploadManager::WaitIdle()
+    {
+        Flush();
+        while (!m_submissions.empty())
+        {
+            vkWaitForFences(m_app->GetVkDevice(), 1, &m_submissions.front().Fence, VK_TRUE, UINT64_MAX);
+            RetireFront();
+        }
+    }
+}
@@ -338,9 +338,13 @@ namespace gfx
         *width = m_swapChainExtent.width;
         *height = m_swapChainExtent.height;
     }
-    VkResult GFXVulkanViewport::AcquireNextImage(uint32_t* outIndex)
+    uint32_t GFXVulkanViewport::NextFrame()
     {
         m_currentFrame = (m_currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+        return static_cast<uint32_t>(m_currentFrame);
+    }
+    VkResult GFXVulkanViewport::AcquireNextImage(uint32_t* outIndex)
+    {
         auto result = vkAcquireNextImageKHR(m_app->GetVkDevice(), GetVkSwapChain(), UINT64_MAX, m_imageAvailableSemaphores[m_currentFrame], VK_NULL_HANDLE, &m_imageIndex);
         *outIndex = m_imageIndex;
         return result;
@@ -45,7 +45,7 @@ namespace gfx
     }
 
     void ImageHelper::CreateImage(GFXVulkanApplication* app,
-        VkImageCreateInfo* info, VkMemoryPropertyFlags properties, VkImage& image, VkDeviceMemory& imageMemory)
+        VkImageCreateInfo* info, VkMemoryPropertyFlags properties, VkImage& image, GFXVulkanMemoryAllocation& imageMemory)
     {
         if (vkCreateImage(app->GetVkDevice(), info, nullptr, &image) != VK_SUCCESS)
         {
@@ -55,17 +55,9 @@ namespace gfx
         VkMemoryRequirements memRequirements;
         vkGetImageMemoryRequirements(app->GetVkDevice(), image, &memRequirements);
 
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = gfx::BufferHelper::FindMemoryType(app, memRequirements.memoryTypeBits, properties);
+        imageMemory = app->GetMemoryAllocator()->Allocate(memRequirements, properties, info->tiling == VK_IMAGE_TILING_LINEAR);
 
-        if (vkAllocateMemory(app->GetVkDevice(), &allocInfo, nullptr, &imageMemory) != VK_SUCCESS)
-        {
-            throw std::runtime_error("failed to allocate image memory!");
-        }
-
-        vkBindImageMemory(app->GetVkDevice(), image, imageMemory, 0);
+        vkBindImageMemory(app->GetVkDevice(), image, imageMemory.Memory, imageMemory.Offset);
     }
 
     VkImageViewCreateInfo ImageHelper::ImageViewCreateInfo()
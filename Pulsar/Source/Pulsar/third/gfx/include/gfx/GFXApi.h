@@ -7,6 +7,8 @@ namespace gfx
         Unknown,
         D3D12,
         Vulkan,
+        // headless, records and counts without a device
+        Null,
     };
 
     inline const char* to_string(GFXApi api)
@@ -16,6 +18,7 @@ namespace gfx
         case gfx::GFXApi::Unknown: return "NONE";
         case gfx::GFXApi::D3D12: return "D3D12";
         case gfx::GFXApi::Vulkan: return "Vulkan";
+        case gfx::GFXApi::Null: return "Null";
         }
         return nullptr;
     }
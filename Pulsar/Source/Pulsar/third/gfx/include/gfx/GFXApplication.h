@@ -3,10 +3,12 @@
 #include "GFXBuffer.h"
 #include "GFXCommandBuffer.h"
 #include "GFXDescriptorManager.h"
+#include "GFXDynamicBuffer.h"
 #include "GFXExtensions.h"
 #include "GFXGlobalConfig.h"
 #include "GFXGpuProgram.h"
 #include "GFXGraphicsPipelineManager.h"
+#include "GFXMemoryStatistics.h"
 #include "GFXInclude.h"
 #include "GFXRenderPass.h"
 #include "GFXRenderPipeline.h"
@@ -52,6 +54,8 @@ namespace gfx
         }
         virtual GFXExtensions GetExtensionNames() = 0;
         virtual GFXApi GetApiType() const = 0;
+        // the api whose compiled shaders the backend consumes
+        virtual GFXApi GetShaderApiType() const { return GetApiType(); }
         virtual const char* GetApiLevelName() const = 0;
 
         virtual void SetRenderPipeline(GFXRenderPipeline* pipeline) = 0;
@@ -74,6 +78,8 @@ namespace gfx
             const GFXGpuProgram_sp& gpuProgram) = 0;
 
         virtual GFXDescriptorManager* GetDescriptorManager() = 0;
+        virtual GFXDynamicBuffer* GetDynamicBuffer() = 0;
+        virtual GFXMemoryStatistics GetMemoryStatistics() const = 0;
 
         virtual GFXDescriptorSetLayout_sp CreateDescriptorSetLayout(
             const GFXDescriptorSetLayoutInfo* layouts,
@@ -0,0 +1,132 @@
+#pragma once
+#include "GFXCommandBuffer.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace gfx
+{
+    // bindings recorded into a command buffer so far, shared by the backends so redundant binds are
+    // skipped and counted the same way everywhere. the handle types are what a bind resolves to in the backend
+    template<typename TPipeline, typename TBuffer, typename TDescriptorSet, typename TDescriptorSetLayout>
+    class GFXCommandBindState
+    {
+    public:
+        static constexpr uint32_t kMaxDescriptorSets = 8;
+        static constexpr uint32_t kMaxDynamicOffsetsPerSet = 4;
+        static constexpr uint32_t kMaxVertexBuffers = 8;
+
+        struct DescriptorSet
+        {
+            TDescriptorSet Set{};
+            // sets stay bound across pipelines while the layouts up to them match
+            TDescriptorSetLayout Layout{};
+            uint32_t DynamicOffsetCount{};
+            std::array<uint32_t, kMaxDynamicOffsetsPerSet> DynamicOffsets{};
+
+            bool operator==(const DescriptorSet& r) const
+            {
+                return Set == r.Set && Layout == r.Layout && DynamicOffsetCount == r.DynamicOffsetCount &&
+                    std::equal(DynamicOffsets.begin(), DynamicOffsets.begin() + DynamicOffsetCount, r.DynamicOffsets.begin());
+            }
+        };
+        using DescriptorSets = std::array<DescriptorSet, kMaxDescriptorSets>;
+
+        void Reset() { *this = {}; }
+
+        TBuffer GetIndexBuffer() const { return m_indexBuffer; }
+
+        // the Bind functions return false when the binding is already current
+        bool BindPipeline(TPipeline pipeline, GFXCommandBufferStats& stats)
+        {
+            if (m_pipeline == pipeline)
+            {
+                ++stats.SkippedPipelineBindCount;
+                return false;
+            }
+            m_pipeline = pipeline;
+            ++stats.PipelineBindCount;
+            return true;
+        }
+
+        bool BindVertexBuffers(const TBuffer* buffers, uint32_t count, GFXCommandBufferStats& stats)
+        {
+            assert(count <= kMaxVertexBuffers);
+            if (m_vertexBufferCount == count && std::equal(buffers, buffers + count, m_vertexBuffers.begin()))
+            {
+                ++stats.SkippedVertexBufferBindCount;
+                return false;
+            }
+            std::copy(buffers, buffers + count, m_vertexBuffers.begin());
+            m_vertexBufferCount = count;
+            ++stats.VertexBufferBindCount;
+            return true;
+        }
+
+        bool BindIndexBuffer(TBuffer buffer, size_t indexSize, GFXCommandBufferStats& stats)
+        {
+            if (m_indexBuffer == buffer && m_indexSize == indexSize)
+            {
+                ++stats.SkippedIndexBufferBindCount;
+                return false;
+            }
+            m_indexBuffer = buffer;
+            m_indexSize = indexSize;
+            ++stats.IndexBufferBindCount;
+            return true;
+        }
+
+        // sets come with Set, Layout and DynamicOffsetCount filled, their offsets are taken from dynamicOffsets in order.
+        // returns the first set that has to be rebound, count when all are current,
+        // and the index of its first dynamic offset in firstChangedOffset
+        uint32_t BindDescriptorSets(
+            DescriptorSets& sets, uint32_t count, const array_list<uint32_t>& dynamicOffsets,
+            uint32_t& firstChangedOffset, GFXCommandBufferStats& stats)
+        {
+            assert(count <= kMaxDescriptorSets);
+            uint32_t firstChanged = count;
+            uint32_t offsetIndex = 0;
+            firstChangedOffset = 0;
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                auto& set = sets[i];
+                assert(set.DynamicOffsetCount <= kMaxDynamicOffsetsPerSet);
+                assert(offsetIndex + set.DynamicOffsetCount <= dynamicOffsets.size());
+
+                const auto setOffsetIndex = offsetIndex;
+                for (uint32_t j = 0; j < set.DynamicOffsetCount; ++j)
+                {
+                    set.DynamicOffsets[j] = dynamicOffsets[offsetIndex++];
+                }
+
+                if (firstChanged == count && (i >= m_descriptorSetCount || !(m_descriptorSets[i] == set)))
+                {
+                    firstChanged = i;
+                    firstChangedOffset = setOffsetIndex;
+                }
+            }
+            assert(offsetIndex == dynamicOffsets.size());
+
+            stats.SkippedDescriptorSetBindCount += firstChanged;
+            if (firstChanged == count)
+            {
+                return count;
+            }
+            stats.DescriptorSetBindCount += count - firstChanged;
+
+            // sets after the first changed one may be disturbed, forget them
+            m_descriptorSets = sets;
+            m_descriptorSetCount = count;
+            return firstChanged;
+        }
+
+    private:
+        TPipeline m_pipeline{};
+        DescriptorSets m_descriptorSets{};
+        uint32_t m_descriptorSetCount{};
+        std::array<TBuffer, kMaxVertexBuffers> m_vertexBuffers{};
+        uint32_t m_vertexBufferCount{};
+        TBuffer m_indexBuffer{};
+        size_t m_indexSize{};
+    };
+}
@@ -17,6 +17,20 @@ namespace gfx
         ShaderReadOnly
     };
 
+    // bind calls since Begin(), skipped ones did not change the bound state
+    struct GFXCommandBufferStats
+    {
+        uint32_t PipelineBindCount{};
+        uint32_t SkippedPipelineBindCount{};
+        uint32_t DescriptorSetBindCount{};
+        uint32_t SkippedDescriptorSetBindCount{};
+        uint32_t VertexBufferBindCount{};
+        uint32_t SkippedVertexBufferBindCount{};
+        uint32_t IndexBufferBindCount{};
+        uint32_t SkippedIndexBufferBindCount{};
+        uint32_t DrawCount{};
+    };
+
     class GFXCommandBuffer
     {
     public:
@@ -31,10 +45,12 @@ namespace gfx
         virtual void CmdBindGraphicsPipeline(GFXGraphicsPipeline* pipeline) = 0;
         virtual void CmdBindVertexBuffers(const std::vector<GFXBuffer*>& buffers) = 0;
         virtual void CmdBindIndexBuffer(GFXBuffer* buffer) = 0;
-        virtual void CmdBindDescriptorSets(const array_list<GFXDescriptorSet*>& descriptorSet, GFXGraphicsPipeline* pipeline) = 0;
+        virtual void CmdBindDescriptorSets(
+            const array_list<GFXDescriptorSet*>& descriptorSet, GFXGraphicsPipeline* pipeline,
+            const array_list<uint32_t>& dynamicOffsets = {}) = 0;
 
         virtual void CmdDraw(size_t vertexCount) = 0;
-        virtual void CmdDrawIndexed(size_t indicesCount) = 0;
+        virtual void CmdDrawIndexed(size_t indicesCount, uint32_t instanceCount = 1) = 0;
         virtual void CmdClearColor(GFXTexture* rt, float r, float g, float b, float a) = 0;
         virtual void CmdClearColor(GFXTexture* rt) = 0;
 
@@ -47,6 +63,7 @@ namespace gfx
         virtual void CmdImageTransitionBarrier(GFXTextureView* rt, GFXResourceLayout layout) = 0;
     public:
         virtual GFXApplication* GetApplication() const = 0;
+        virtual const GFXCommandBufferStats& GetStats() const = 0;
 
     };
     GFX_DECL_SPTR(GFXCommandBuffer);
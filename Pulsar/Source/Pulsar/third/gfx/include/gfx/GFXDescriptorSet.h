@@ -11,7 +11,10 @@ namespace gfx
         ConstantBuffer,
         StructuredBuffer,
         CombinedImageSampler,
-        Texture2D
+        Texture2D,
+        // bound with a dynamic offset into GFXDynamicBuffer
+        DynamicConstantBuffer,
+        DynamicStructuredBuffer,
     };
     enum class GFXShaderStageFlags : uint32_t
     {
@@ -45,6 +48,8 @@ namespace gfx
             : Type(type), Stage(stage), BindingPoint(bindingPoint)
         {
         }
+
+        bool operator==(const GFXDescriptorSetLayoutInfo&) const = default;
     };
 
     class GFXDescriptorSetLayout
@@ -54,6 +59,11 @@ namespace gfx
         {
         }
         virtual ~GFXDescriptorSetLayout() {}
+    public:
+        // the bindings the layout was created from, equal for identically defined layouts
+        const array_list<GFXDescriptorSetLayoutInfo>& GetLayoutInfos() const { return m_layoutInfos; }
+    protected:
+        array_list<GFXDescriptorSetLayoutInfo> m_layoutInfos;
     };
     GFX_DECL_SPTR(GFXDescriptorSetLayout);
 
@@ -68,6 +78,8 @@ namespace gfx
         virtual void SetStructuredBuffer(GFXBuffer* buffer) = 0;
         virtual void SetTextureSampler2D(GFXTexture2DView* texture) = 0;
         virtual void SetTexture2D(GFXTexture* texture) = 0;
+        virtual void SetDynamicConstantBuffer(GFXBuffer* buffer, size_t range) = 0;
+        virtual void SetDynamicStructuredBuffer(GFXBuffer* buffer, size_t range) = 0;
 
         bool IsDirty;
         std::string name;
@@ -0,0 +1,49 @@
+#pragma once
+#include "GFXBuffer.h"
+#include "GFXInclude.h"
+#include <cstring>
+
+namespace gfx
+{
+    struct GFXDynamicBufferAllocation
+    {
+        void* Data;
+        // offset in GetBuffer(), passed to CmdBindDescriptorSets as a dynamic offset
+        uint32_t Offset;
+        size_t Size;
+    };
+
+    // persistently mapped ring of per frame memory, shared by all dynamic descriptors.
+    // allocations stay valid until the same frame slot comes around again.
+    class GFXDynamicBuffer
+    {
+    public:
+        GFXDynamicBuffer() = default;
+        GFXDynamicBuffer(const GFXDynamicBuffer&) = delete;
+        virtual ~GFXDynamicBuffer() = default;
+    public:
+        // can be called from any recording thread, the frame has to be reserved for it
+        virtual GFXDynamicBufferAllocation Allocate(size_t size) = 0;
+        // grows the frame capacity to fit allocationCount allocations of allocationSize.
+        // main thread, before the first allocation of the frame. growing replaces GetBuffer()
+        virtual void Reserve(size_t allocationCount, size_t allocationSize) = 0;
+
+        uint32_t Push(const void* data, size_t size)
+        {
+            auto allocation = Allocate(size);
+            memcpy(allocation.Data, data, size);
+            return allocation.Offset;
+        }
+        template<typename T>
+        uint32_t Push(const T& data)
+        {
+            return Push(&data, sizeof(T));
+        }
+
+        virtual GFXBuffer* GetBuffer() const = 0;
+        // upper bound of the range a dynamic descriptor can bind
+        virtual size_t GetMaxBindingRange() const = 0;
+        virtual size_t GetFrameCapacity() const = 0;
+        virtual size_t GetFrameUsedSize() const = 0;
+    };
+}
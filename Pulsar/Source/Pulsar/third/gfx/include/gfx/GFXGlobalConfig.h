@@ -1,4 +1,6 @@
 #pragma once
+#include "GFXApi.h"
+#include <cstdint>
 
 namespace gfx
 {
@@ -10,6 +12,12 @@ namespace gfx
         bool EnableValid;
         char Title[256];
         char ProgramName[256];
+        // compiled pipelines are kept here between runs, empty disables it
+        char PipelineCachePath[512];
+        // Unknown picks the default backend
+        GFXApi Api;
+        // frames the null backend runs before ExecLoop returns, 0 runs until RequestStop
+        uint32_t HeadlessFrameCount;
     };
 
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+#include "GFXDescriptorSet.h"
+#include "GFXGraphicsPipeline.h"
+#include "GFXRenderPass.h"
+
+namespace gfx
+{
+    constexpr size_t HashS0 = 2166136261;
+    constexpr size_t HashS1 = 16777619;
+
+    inline size_t HashCombine(size_t hash, size_t value)
+    {
+        return (hash ^ value) * HashS1;
+    }
+
+    // everything a graphics pipeline is built from, flattened into words. render passes, descriptor set
+    // layouts and vertex layouts are kept by content, so identically defined objects share pipelines
+    // and keys with colliding hashes still compare unequal
+    struct GFXGraphicsPipelineKey
+    {
+        size_t Hash{};
+        // the shader pass, then each list prefixed with its size
+        array_list<uint64_t> Words;
+
+        static GFXGraphicsPipelineKey Make(
+            const GFXShaderPass* shaderPass,
+            const array_list<GFXDescriptorSetLayout_sp>& descriptorSetLayouts,
+            const GFXRenderPassLayout& renderPass,
+            const GFXGraphicsPipelineState& gpInfo);
+
+        bool operator==(const GFXGraphicsPipelineKey&) const = default;
+    };
+
+    struct GFXGraphicsPipelineKeyHash
+    {
+        size_t operator()(const GFXGraphicsPipelineKey& key) const { return key.Hash; }
+    };
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "GFXInclude.h"
+
+namespace gfx
+{
+    struct GFXMemoryStatistics
+    {
+        // device memory objects, dedicated allocations included
+        size_t BlockCount{};
+        size_t AllocationCount{};
+        uint64_t ReservedSize{};
+        uint64_t UsedSize{};
+        size_t FreeRangeCount{};
+        uint64_t LargestFreeRange{};
+
+        // 0 when all free memory is one contiguous range, close to 1 when it is scattered
+        float GetFragmentation() const
+        {
+            const auto freeSize = ReservedSize - UsedSize;
+            if (freeSize == 0)
+            {
+                return 0.f;
+            }
+            return 1.f - static_cast<float>(LargestFreeRange) / static_cast<float>(freeSize);
+        }
+    };
+}
@@ -10,6 +10,12 @@ namespace gfx
         GFXRenderPassLayout() = default;
         GFXRenderPassLayout(const GFXRenderPassLayout&) = delete;
         GFXRenderPassLayout(GFXRenderPassLayout&&) = delete;
+    public:
+        // one entry per attachment (format, samples and target type), equal for render passes
+        // a pipeline can be used with interchangeably
+        const array_list<uint64_t>& GetCompatibilityKey() const { return m_compatibilityKey; }
+    protected:
+        array_list<uint64_t> m_compatibilityKey;
     };
     GFX_DECL_SPTR(GFXRenderPassLayout);
 }
\ No newline at end of file
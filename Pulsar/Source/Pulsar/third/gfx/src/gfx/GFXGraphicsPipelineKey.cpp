@@ -0,0 +1,53 @@
+#include <gfx/GFXGraphicsPipelineKey.h>
+#include <bit>
+
+namespace gfx
+{
+    GFXGraphicsPipelineKey GFXGraphicsPipelineKey::Make(
+        const GFXShaderPass* shaderPass,
+        const array_list<GFXDescriptorSetLayout_sp>& descriptorSetLayouts,
+        const GFXRenderPassLayout& renderPass,
+        const GFXGraphicsPipelineState& gpInfo)
+    {
+        GFXGraphicsPipelineKey key;
+        auto& words = key.Words;
+
+        words.push_back(reinterpret_cast<uintptr_t>(shaderPass));
+
+        const auto& attachments = renderPass.GetCompatibilityKey();
+        words.push_back(attachments.size());
+        words.insert(words.end(), attachments.begin(), attachments.end());
+
+        words.push_back(descriptorSetLayouts.size());
+        for (const auto& layout : descriptorSetLayouts)
+        {
+            const auto& infos = layout->GetLayoutInfos();
+            words.push_back(infos.size());
+            for (const auto& info : infos)
+            {
+                words.push_back(uint64_t(info.BindingPoint) << 32 | uint64_t(info.Type) << 16 | uint64_t(info.Stage));
+            }
+        }
+
+        words.push_back(uint64_t(gpInfo.Topology) << 32 | std::bit_cast<uint32_t>(gpInfo.LineWidth));
+
+        words.push_back(gpInfo.VertexLayouts.size());
+        for (const auto& vertexLayout : gpInfo.VertexLayouts)
+        {
+            words.push_back(uint64_t(vertexLayout->BindingPoint) << 32 | vertexLayout->Stride);
+            words.push_back(vertexLayout->Attributes.size());
+            for (const auto& attribute : vertexLayout->Attributes)
+            {
+                words.push_back(uint64_t(attribute.Location) << 32 | uint64_t(attribute.Format));
+                words.push_back(attribute.Offset);
+            }
+        }
+
+        key.Hash = HashS0;
+        for (const auto word : words)
+        {
+            key.Hash = HashCombine(key.Hash, static_cast<size_t>(word));
+        }
+        return key;
+    }
+}
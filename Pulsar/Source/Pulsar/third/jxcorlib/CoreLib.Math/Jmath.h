@@ -1122,6 +1122,60 @@ namespace jmath
     using BoxSphereBounds3d = BoxSphereBounds3<float>;
 
 
+    /*
+     * plane: xyz is the inward normal, w is the distance.
+     * dot(n, p) + w >= 0 is inside.
+     */
+    template <typename T>
+    struct Frustum3
+    {
+        Vector4<T> Planes[6]{};
+
+        // clip space: -w <= x <= w, -w <= y <= w, 0 <= z <= w
+        static Frustum3 CreateFromMatrix_ZO(const Matrix4<T>& viewProjection)
+        {
+            const auto r0 = viewProjection.GetRow(0);
+            const auto r1 = viewProjection.GetRow(1);
+            const auto r2 = viewProjection.GetRow(2);
+            const auto r3 = viewProjection.GetRow(3);
+
+            Frustum3 frustum;
+            frustum.Planes[0] = r3 + r0; // left
+            frustum.Planes[1] = r3 - r0; // right
+            frustum.Planes[2] = r3 + r1; // bottom
+            frustum.Planes[3] = r3 - r1; // top
+            frustum.Planes[4] = r2;      // near
+            frustum.Planes[5] = r3 - r2; // far
+
+            for (auto& plane : frustum.Planes)
+            {
+                auto len = Magnitude(plane.xyz());
+                if (len != T(0))
+                {
+                    plane /= len;
+                }
+            }
+            return frustum;
+        }
+
+        bool IsOverlapped(const BoxSphereBounds3<T>& bounds) const
+        {
+            for (auto& plane : Planes)
+            {
+                const auto normal = plane.xyz();
+                const T distance = Dot(normal, bounds.Origin) + plane.w;
+                const T boxRadius = Dot(Abs(normal), bounds.Extent);
+                if (distance < -std::min(boxRadius, bounds.Radius))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+    using Frustum3f = Frustum3<float>;
+
+
     template <typename T>
     struct Edge3
     {
@@ -111,6 +111,7 @@ namespace jxcorlib::ser
         virtual std::shared_ptr<Varient> New(VarientType type = VarientType::Null) const override
         {
             auto p = new VarientJson;
+            p->isBinary = isBinary;
             switch (type)
             {
             case jxcorlib::ser::VarientType::Null:
@@ -180,10 +181,21 @@ namespace jxcorlib::ser
 
         virtual void AssignParse(std::string_view content) override
         {
+            if (isBinary)
+            {
+                js = json::from_msgpack(content.begin(), content.end());
+                return;
+            }
             js = json::parse(content);
         }
         virtual std::string ToString(bool readable = true) const override
         {
+            if (isBinary)
+            {
+                std::string bytes;
+                json::to_msgpack(js, bytes);
+                return bytes;
+            }
             return js.dump(readable ? 4 : -1);
         }
 
@@ -214,6 +226,9 @@ namespace jxcorlib::ser
             js.clear();
         }
 
+    public:
+        // msgpack provider, parses and prints the binary encoding instead of text
+        bool isBinary = false;
     protected:
         json js;
     };
@@ -245,6 +260,12 @@ namespace jxcorlib::ser
         {
             return std::shared_ptr<Varient>(new VarientJson);
         }
+        if (provider == "msgpack")
+        {
+            auto varient = new VarientJson;
+            varient->isBinary = true;
+            return std::shared_ptr<Varient>(varient);
+        }
         return {};
     }
 
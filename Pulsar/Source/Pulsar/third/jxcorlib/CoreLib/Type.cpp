@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <iostream>
+#include <atomic>
 
 #include "CommonException.h"
 #include "Reflection.h"
@@ -11,6 +12,10 @@
 
 namespace jxcorlib
 {
+    // constant initialized, types are created during dynamic initialization
+    static std::atomic<uint32_t> s_typeCount{0};
+    // bumped by every added member info, field caches older than it are rebuilt
+    static std::atomic<uint32_t> s_memberVersion{1};
 
     Type::Type(
         CreateInstFunc dyncreate,
@@ -28,7 +33,8 @@ namespace jxcorlib
         m_assembly(assembly),
         m_isInterface(false),
         m_enumGetter(nullptr),
-        m_isGeneric(isGeneric)
+        m_isGeneric(isGeneric),
+        m_typeIndex(s_typeCount.fetch_add(1, std::memory_order_relaxed))
     {
         assert(assembly);
         assert(name.length());
@@ -59,6 +65,17 @@ namespace jxcorlib
         {
             m_shortName = m_name;
         }
+
+        if (base)
+        {
+            m_ancestors = base->m_ancestors;
+        }
+        m_ancestors.push_back(this);
+    }
+
+    uint32_t Type::GetTypeCount()
+    {
+        return s_typeCount.load(std::memory_order_relaxed);
     }
 
     bool Type::IsImplementedInterface(Type* type)
@@ -100,17 +117,12 @@ namespace jxcorlib
 
     bool Type::IsSubclassOf(const Type* type) const
     {
-        const Type* base = this;
-        while (base != nullptr)
+        if (type == nullptr)
         {
-            if (base == type) {
-                return true;
-            }
-            else {
-                base = base->GetBase();
-            }
+            return false;
         }
-        return false;
+        const auto depth = type->m_ancestors.size() - 1;
+        return depth < this->m_ancestors.size() && this->m_ancestors[depth] == type;
     }
 
     Object* Type::CreateInstance(const ParameterPackage& v)
@@ -187,6 +199,34 @@ namespace jxcorlib
     }
 
     void Type::GetFieldInfos(array_list<FieldInfo*>& out, TypeBinding attr)
+    {
+        const auto& fields = this->GetFieldInfos(attr);
+        out.insert(out.end(), fields.begin(), fields.end());
+    }
+
+    FieldInfoList Type::GetFieldInfos(TypeBinding attr)
+    {
+        auto& cache = this->m_fieldSnapshots[EnumHasFlag(attr, TypeBinding::NonPublic) ? 1 : 0];
+        const auto version = s_memberVersion.load(std::memory_order_acquire);
+        auto snapshot = cache.load(std::memory_order_acquire);
+        if (!snapshot || snapshot->Version != version)
+        {
+            std::lock_guard lock{this->m_fieldCacheMutex};
+            snapshot = cache.load(std::memory_order_relaxed);
+            if (!snapshot || snapshot->Version != version)
+            {
+                auto newSnapshot = std::make_shared<FieldSnapshot>();
+                newSnapshot->Version = version;
+                this->_CollectFieldInfos(newSnapshot->Fields, attr);
+                snapshot = std::move(newSnapshot);
+                cache.store(snapshot, std::memory_order_release);
+            }
+        }
+        // shares the ownership of the snapshot
+        return FieldInfoList{{snapshot, &snapshot->Fields}};
+    }
+
+    void Type::_CollectFieldInfos(array_list<FieldInfo*>& out, TypeBinding attr)
     {
         Type* fieldinfo_type = cltypeof<FieldInfo>();
 
@@ -204,17 +244,11 @@ namespace jxcorlib
         }
         if (this->GetBase())
         {
-            this->GetBase()->GetFieldInfos(out, attr);
+            const auto baseFields = this->GetBase()->GetFieldInfos(attr);
+            out.insert(out.end(), baseFields.begin(), baseFields.end());
         }
     }
 
-    array_list<FieldInfo*> Type::GetFieldInfos(TypeBinding attr)
-    {
-        array_list<FieldInfo*> v;
-        this->GetFieldInfos(v, attr);
-        return v;
-    }
-
     FieldInfo* Type::GetFieldInfo(const string& name)
     {
         if (this->m_memberInfos.find(name) == this->m_memberInfos.end())
@@ -288,6 +322,7 @@ namespace jxcorlib
     void Type::_AddMemberInfo(MemberInfo* info)
     {
         this->m_memberInfos.insert({ info->GetName(), mksptr(info) });
+        s_memberVersion.fetch_add(1, std::memory_order_acq_rel);
     }
 
     IInterface_sp Type::GetSharedInterface(Object_rsp instance, Type* type)
@@ -13,6 +13,8 @@
 #include <type_traits>
 #include <memory>
 #include <functional>
+#include <atomic>
+#include <mutex>
 
 #include "UString.h"
 #include "Object.h"
@@ -225,6 +227,25 @@ namespace jxcorlib
     template<typename K, typename V>
     using map = std::map<K, V>;
 
+    // immutable snapshot of the flattened fields of a type, stays valid when members are added later
+    class FieldInfoList
+    {
+    public:
+        using value_type = FieldInfo*;
+        using const_iterator = array_list<FieldInfo*>::const_iterator;
+
+        FieldInfoList() = default;
+        explicit FieldInfoList(std::shared_ptr<const array_list<FieldInfo*>> fields) : m_fields(std::move(fields)) {}
+
+        const_iterator begin() const { return m_fields->begin(); }
+        const_iterator end() const { return m_fields->end(); }
+        size_t size() const { return m_fields ? m_fields->size() : 0; }
+        bool empty() const { return size() == 0; }
+        FieldInfo* operator[](size_t index) const { return (*m_fields)[index]; }
+    private:
+        std::shared_ptr<const array_list<FieldInfo*>> m_fields = std::make_shared<const array_list<FieldInfo*>>();
+    };
+
     class IInterface
     {
     private:
@@ -287,11 +308,24 @@ namespace jxcorlib
         EnumGetter             m_enumGetter;
         bool                   m_isInterface;
         bool                   m_isGeneric;
+        uint32_t               m_typeIndex;
+        // base chain from the root type down to this, indexed by depth
+        array_list<const Type*> m_ancestors;
 
         array_list<SPtr<Attribute>>    m_attributes;
         std::map<string, SPtr<MemberInfo>>  m_memberInfos;
         array_list<std::tuple<Type*, InterfaceGetter, SharedInterfaceGetter>> m_interfaces;
 
+        // flattened fields of this and its bases, public only and with non public.
+        // a new snapshot is published when member infos were added since it was built, old ones are never changed
+        struct FieldSnapshot
+        {
+            uint32_t               Version;
+            array_list<FieldInfo*> Fields;
+        };
+        std::atomic<std::shared_ptr<const FieldSnapshot>> m_fieldSnapshots[2];
+        std::mutex             m_fieldCacheMutex;
+
     private:
         Type(const Type& r) = delete;
         Type(Type&& r) = delete;
@@ -311,6 +345,11 @@ namespace jxcorlib
         const string&           GetShortName() const { return this->m_shortName; }
         Type*                   GetBase() const { return this->m_base; }
         const std::type_info&   GetTypeInfo() const { return this->m_typeinfo; }
+        // dense index in creation order, usable for per type lookup tables
+        uint32_t                GetTypeIndex() const { return this->m_typeIndex; }
+        // number of bases above this type
+        uint32_t                GetDepth() const { return static_cast<uint32_t>(this->m_ancestors.size() - 1); }
+        static uint32_t         GetTypeCount();
         array_list<Type*>       GetInterfaces() const;
 
         bool IsPrimitiveType() const;
@@ -362,7 +401,8 @@ namespace jxcorlib
 
         FieldInfo*              GetFieldInfo(const string& name);
         void                    GetFieldInfos(array_list<FieldInfo*>& out, TypeBinding attr = TypeBinding::None);
-        array_list<FieldInfo*>  GetFieldInfos(TypeBinding attr = TypeBinding::None);
+        // cached, own fields first and then the ones of the bases
+        FieldInfoList           GetFieldInfos(TypeBinding attr = TypeBinding::None);
 
         MethodInfo*             GetMethodInfo(const string& name);
         void                    GetMethodInfos(array_list<MethodInfo*>& out, TypeBinding attr = TypeBinding::None);
@@ -401,6 +441,7 @@ namespace jxcorlib
         const EnumAccessor*    GetEnumAccessors();
     private:
         void _AddMemberInfo(MemberInfo* info);
+        void _CollectFieldInfos(array_list<FieldInfo*>& out, TypeBinding attr);
         std::unique_ptr<EnumAccessor> m_enumAccessor;
     public:
 
@@ -23,6 +23,11 @@ SOFTWARE.
 */
 
 #pragma once
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
 #include <unordered_map>
 #include <string>
 #include <string_view>
@@ -30,124 +35,162 @@ SOFTWARE.
 
 struct index_string_block
 {
-    void* bytes;
+    const void* bytes;
+    // in bytes, with the terminator
     size_t size;
 };
 
+// interns strings by content. every distinct string gets one id for the lifetime of the process,
+// so two index strings are equal exactly when their ids are equal.
+// lookups by id are lock free, interning locks one of the shards picked by the hash.
 struct __index_string_manager final
 {
-    static auto GetIndexStringMap()
+    static constexpr size_t shard_count = 16;
+    static constexpr size_t page_bits = 12;
+    static constexpr size_t page_size = size_t(1) << page_bits;
+    static constexpr size_t max_pages = 4096;
+
+    static __index_string_manager& get()
     {
-        auto static map = new std::unordered_map<size_t, index_string_block>;
-        //96kb
-        map->reserve(4096);
-        return map;
+        // never destroyed, index strings are used from static destructors
+        static auto mgr = new __index_string_manager;
+        return *mgr;
     }
-};
 
-template<typename T>
-struct basic_index_string
-{
-protected:
-    using char_t = T;
-    using index_t = size_t;
-    constexpr static index_t none = 0;
-protected:
-    static constexpr size_t ELFHash(const char_t* str, size_t size)
+    // FNV-1a
+    static uint64_t hash_bytes(const void* data, size_t size)
     {
-        constexpr size_t TotalBits = sizeof(size_t) * 8;
-        constexpr size_t ThreeQuarters = (TotalBits * 3) / 4;
-        constexpr size_t OneEighth = TotalBits / 8;
-        constexpr size_t HighBits = ((size_t)-1) << (TotalBits - OneEighth);
-        size_t hash = 0;
-        size_t magic = 0;
+        uint64_t hash = 14695981039346656037ull;
+        const auto bytes = static_cast<const unsigned char*>(data);
         for (size_t i = 0; i < size; ++i)
         {
-            const size_t ch = str[i];
-            hash = (hash << OneEighth) + ch;
-            if ((magic = hash & HighBits) != 0)
-            {
-                hash ^= (magic >> ThreeQuarters);
-                hash &= ~magic;
-            }
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
         }
         return hash;
     }
-public:
-    basic_index_string(const basic_index_string&) = default;
-    constexpr basic_index_string() = default;
-    constexpr basic_index_string(const char_t* str) : basic_index_string(std::basic_string_view<char_t>(str)) {}
-    constexpr basic_index_string(const std::basic_string<char_t>& str) : basic_index_string(std::basic_string_view<char_t>(str)) {}
-    constexpr basic_index_string(const std::basic_string_view<char_t>& view)
+
+    size_t intern(const void* data, size_t size, size_t char_size)
     {
-        if (view.empty())
+        const auto hash = hash_bytes(data, size);
+        auto& shard = shards[(hash >> 32) % shard_count];
         {
-            return;
+            std::shared_lock lock{ shard.mutex };
+            if (const auto id = find(shard, hash, data, size, char_size))
+            {
+                return id;
+            }
+        }
+        std::unique_lock lock{ shard.mutex };
+        if (const auto id = find(shard, hash, data, size, char_size))
+        {
+            return id;
         }
 
-        auto hash = ELFHash(view.data(), view.length());
-
-        auto map = __index_string_manager::GetIndexStringMap();
+        const auto bytes = new char[size + char_size];
+        ::memcpy(bytes, data, size);
+        ::memset(bytes + size, 0, char_size);
 
-        auto it = map->find(hash);
-        if (it == map->end())
+        const auto id = next_id.fetch_add(1, std::memory_order_relaxed);
+        if ((id >> page_bits) >= max_pages)
         {
-            index_string_block block{};
+            throw std::length_error("index_string table is full");
+        }
+        ensure_page(id >> page_bits);
+        block_at(id) = index_string_block{ bytes, size + char_size };
+        // published by the shard lock, ids reach other threads through it or through synchronized copies
+        shard.map.emplace(hash, id);
+        return id;
+    }
 
-            const size_t view_len = view.length();
-            const size_t block_len = view_len + 1;
+    index_string_block& block_at(size_t id)
+    {
+        return pages[id >> page_bits].load(std::memory_order_acquire)[id & (page_size - 1)];
+    }
 
-            block.bytes = new char_t[block_len];
-            ::memcpy(block.bytes, view.data(), view_len);
+private:
+    struct shard_t
+    {
+        std::shared_mutex mutex;
+        // equal hashes are told apart by comparing the bytes
+        std::unordered_multimap<uint64_t, size_t> map;
+    };
 
-            reinterpret_cast<char_t*>(block.bytes)[view_len] = 0;
-            block.size = block_len * sizeof(char_t);
+    size_t find(shard_t& shard, uint64_t hash, const void* data, size_t size, size_t char_size)
+    {
+        const auto [begin, end] = shard.map.equal_range(hash);
+        for (auto it = begin; it != end; ++it)
+        {
+            // the stored size includes the terminator, it also keeps strings of different char types apart
+            const auto& block = block_at(it->second);
+            if (block.size == size + char_size && ::memcmp(block.bytes, data, size) == 0)
+            {
+                return it->second;
+            }
+        }
+        return 0;
+    }
 
-            map->emplace(hash, block);
+    void ensure_page(size_t page)
+    {
+        if (pages[page].load(std::memory_order_acquire))
+        {
+            return;
         }
-        else
+        std::lock_guard lock{ page_mutex };
+        if (!pages[page].load(std::memory_order_relaxed))
         {
-            const size_t block_len = it->second.size / sizeof(char_t);
-            const size_t str_len = block_len - 1;
-
-            bool collision;
-            do
-            {
-                collision = false;
-                if (str_len == view.length() && ::memcmp(it->second.bytes, view.data(), str_len * sizeof(char_t)) != 0)
-                {
-                    collision = true;
-                    ++hash;
-                }
-
-            } while (collision);
+            pages[page].store(new index_string_block[page_size]{}, std::memory_order_release);
         }
-        index = hash;
     }
 
-    static std::basic_string_view<char_t> get_string(index_t index)
+    shard_t shards[shard_count];
+    std::mutex page_mutex;
+    std::atomic<index_string_block*> pages[max_pages]{};
+    // 0 is the empty string
+    std::atomic<size_t> next_id{ 1 };
+};
+
+template<typename T>
+struct basic_index_string
+{
+protected:
+    using char_t = T;
+    using index_t = size_t;
+    constexpr static index_t none = 0;
+public:
+    basic_index_string(const basic_index_string&) = default;
+    constexpr basic_index_string() = default;
+    constexpr basic_index_string(const char_t* str) : basic_index_string(std::basic_string_view<char_t>(str)) {}
+    constexpr basic_index_string(const std::basic_string<char_t>& str) : basic_index_string(std::basic_string_view<char_t>(str)) {}
+    constexpr basic_index_string(const std::basic_string_view<char_t>& view)
     {
-        auto map = __index_string_manager::GetIndexStringMap();
-        auto it = map->find(index);
-        if (it == map->end())
+        if (view.empty())
         {
-            return {};
+            return;
         }
-        return std::basic_string_view(reinterpret_cast<char_t*>(it->second.bytes), it->second.size - 1);
+        index = __index_string_manager::get().intern(view.data(), view.length() * sizeof(char_t), sizeof(char_t));
     }
 
-    std::basic_string<char_t> to_string() const
+    static std::basic_string_view<char_t> get_string(index_t index)
     {
-        if (index == index_t{})
+        if (index == none)
         {
             return {};
         }
-        auto block = __index_string_manager::GetIndexStringMap()->find(index)->second;
+        const auto& block = __index_string_manager::get().block_at(index);
+        return std::basic_string_view<char_t>(static_cast<const char_t*>(block.bytes), block.size / sizeof(char_t) - 1);
+    }
 
-        std::basic_string<char_t> str = reinterpret_cast<char_t*>(block.bytes);
-        return str;
+    std::basic_string<char_t> to_string() const
+    {
+        return std::basic_string<char_t>(get_string(index));
     }
 
+    std::basic_string_view<char_t> view() const
+    {
+        return get_string(index);
+    }
 
     bool empty() const { return index == none; }
 
@@ -156,6 +199,7 @@ public:
         return str.index == this->index;
     }
 
+    // the interned id, unique per distinct string
     index_t index{};
 };
 
@@ -172,4 +216,4 @@ namespace std
             return value.index;
         }
     };
-}
\ No newline at end of file
+}
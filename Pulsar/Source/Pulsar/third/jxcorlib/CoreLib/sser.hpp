@@ -4,11 +4,43 @@
 #include <unordered_map>
 #include <string>
 #include <cstdint>
+#include <cstring>
+#include <cassert>
+#include <bit>
+#include <type_traits>
 #include <iostream>
 
 #define _SSER
 namespace sser
 {
+    namespace detail
+    {
+        // elements whose ReadWriteStream is exactly their bytes, containers of them go through one read or write.
+        // bool is left out for std::vector<bool>
+        template<typename T>
+        constexpr bool is_raw_element_v = (std::is_arithmetic_v<T> || std::is_enum_v<T>) && !std::is_same_v<T, bool>;
+
+        inline void ReadWriteBytes(std::iostream& stream, bool write, void* data, size_t size)
+        {
+            if (size == 0) return;
+            if (write) stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            else stream.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+        }
+
+        template<typename T>
+        inline T ByteSwap(T value)
+        {
+            uint8_t bytes[sizeof(T)];
+            std::memcpy(bytes, &value, sizeof(T));
+            for (size_t i = 0; i < sizeof(T) / 2; i++)
+            {
+                std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
+            }
+            std::memcpy(&value, bytes, sizeof(T));
+            return value;
+        }
+    }
+
 #define SSER_BUILTIN_TYPE(TYPE) inline std::iostream& ReadWriteStream(std::iostream& stream, bool write, TYPE& value) \
     { \
         if (write) stream.write((char*)&value, sizeof(value)); \
@@ -67,9 +99,16 @@ namespace sser
         {
             value.resize(len);
         }
-        for (auto& item : value)
+        if constexpr (detail::is_raw_element_v<T>)
         {
-            ReadWriteStream(stream, write, item);
+            detail::ReadWriteBytes(stream, write, value.data(), value.size() * sizeof(T));
+        }
+        else
+        {
+            for (auto& item : value)
+            {
+                ReadWriteStream(stream, write, item);
+            }
         }
         return stream;
     }
@@ -84,9 +123,16 @@ namespace sser
             if (len > N)
                 len = N;
         }
-        for (size_t i = 0; i < len; i++)
+        if constexpr (detail::is_raw_element_v<T>)
         {
-            ReadWriteStream(stream, write, value[i]);
+            detail::ReadWriteBytes(stream, write, value, len * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = 0; i < len; i++)
+            {
+                ReadWriteStream(stream, write, value[i]);
+            }
         }
         return stream;
     }
@@ -101,9 +147,68 @@ namespace sser
             if (len > N)
                 len = N;
         }
-        for (int i = 0; i < len; i++)
+        if constexpr (detail::is_raw_element_v<T>)
+        {
+            detail::ReadWriteBytes(stream, write, value.data(), len * sizeof(T));
+        }
+        else
         {
-            ReadWriteStream(stream, write, value[i]);
+            for (int i = 0; i < len; i++)
+            {
+                ReadWriteStream(stream, write, value[i]);
+            }
+        }
+        return stream;
+    }
+
+    // little endian on the stream whatever the host is
+    template<typename T> requires std::is_arithmetic_v<T>
+    inline std::iostream& ReadWriteLittleEndian(std::iostream& stream, bool write, T& value)
+    {
+        if constexpr (std::endian::native == std::endian::little || sizeof(T) == 1)
+        {
+            return ReadWriteStream(stream, write, value);
+        }
+        else
+        {
+            T swapped = detail::ByteSwap(value);
+            detail::ReadWriteBytes(stream, write, &swapped, sizeof(T));
+            if (!write) value = detail::ByteSwap(swapped);
+            return stream;
+        }
+    }
+
+    // bulk format: little endian uint32 element count, then all elements as one block.
+    // the element bytes are the format, so it differs from ReadWriteStream for structs with padding or nested containers
+    template<typename T> requires std::is_trivially_copyable_v<T> && (!std::is_same_v<T, bool>)
+    inline std::iostream& ReadWriteBulk(std::iostream& stream, bool write, std::vector<T>& value)
+    {
+        assert(value.size() <= UINT32_MAX);
+        uint32_t len = static_cast<uint32_t>(value.size());
+        ReadWriteLittleEndian(stream, write, len);
+        if (!write) //read
+        {
+            value.resize(len);
+        }
+
+        if constexpr (std::endian::native == std::endian::little || sizeof(T) == 1)
+        {
+            detail::ReadWriteBytes(stream, write, value.data(), value.size() * sizeof(T));
+        }
+        else
+        {
+            static_assert(std::is_arithmetic_v<T>, "bulk structs are stored in host layout, big endian hosts only swap arithmetic elements");
+            if (write)
+            {
+                std::vector<T> swapped(value.size());
+                for (size_t i = 0; i < value.size(); i++) swapped[i] = detail::ByteSwap(value[i]);
+                detail::ReadWriteBytes(stream, write, swapped.data(), swapped.size() * sizeof(T));
+            }
+            else
+            {
+                detail::ReadWriteBytes(stream, write, value.data(), value.size() * sizeof(T));
+                for (auto& item : value) item = detail::ByteSwap(item);
+            }
         }
         return stream;
     }
@@ -92,6 +92,8 @@ namespace pulsared
         static void ReloadAsset(ObjectHandle id);
         static void Save(const RCPtr<AssetObject>& asset);
         static void SaveAll();
+        // writes the object and bulk data of every asset of the package into one cooked package file
+        static bool CookPackage(string_view packageName, const std::filesystem::path& outPath);
         static void NewAsset(string_view folderPath, string_view assetName, Type* assetType);
         static bool CreateAsset(const RCPtr<AssetObject>& asset, string_view path);
         // Delete assets without folder
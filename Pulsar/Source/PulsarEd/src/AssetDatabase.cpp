@@ -3,6 +3,7 @@
 #include "Workspace.h"
 #include <CoreLib.Serialization/JsonSerializer.h>
 #include <CoreLib/File.h>
+#include <Pulsar/CookedAssetPackage.h>
 #include <PulsarEd/AssetProviders/AssetProvider.h>
 #include <filesystem>
 #include <fstream>
@@ -15,6 +16,8 @@ namespace pulsared
 {
 
     static std::unordered_set<RCPtr<AssetObject>> _DirtyObjects;
+    // the same set by asset handle, usable when the object is not loaded
+    static std::unordered_set<ObjectHandle> _DirtyHandles;
 
     class PackageAssetRegistry
     {
@@ -24,6 +27,62 @@ namespace pulsared
 
     static hash_map<string, PackageAssetRegistry> _AssetRegistry;
 
+    // indexes over every package, kept in sync with _AssetRegistry
+    static hash_map<ObjectHandle, string> _AssetPaths;
+    static hash_map<string, ObjectHandle> _AssetIds;
+    static hash_map<string, std::unordered_set<ObjectHandle>> _TypeAssets;
+
+    static void _RegisterAsset(ObjectHandle handle, const string& path, const string& typeName)
+    {
+        _AssetRegistry[AssetDatabase::GetPackageName(path)].AssetPathMapping[handle] = path;
+        _AssetPaths[handle] = path;
+        _AssetIds[path] = handle;
+        _TypeAssets[typeName].insert(handle);
+    }
+
+    static void _UnregisterAsset(ObjectHandle handle)
+    {
+        auto it = _AssetPaths.find(handle);
+        if (it == _AssetPaths.end())
+        {
+            return;
+        }
+        const auto packageIt = _AssetRegistry.find(AssetDatabase::GetPackageName(it->second));
+        if (packageIt != _AssetRegistry.end())
+        {
+            packageIt->second.AssetPathMapping.erase(handle);
+        }
+        _AssetIds.erase(it->second);
+        _AssetPaths.erase(it);
+        for (auto& [typeName, handles] : _TypeAssets)
+        {
+            if (handles.erase(handle))
+            {
+                break;
+            }
+        }
+    }
+
+    static void _MoveAsset(ObjectHandle handle, const string& newPath)
+    {
+        auto it = _AssetPaths.find(handle);
+        if (it == _AssetPaths.end())
+        {
+            return;
+        }
+        const auto oldPackage = AssetDatabase::GetPackageName(it->second);
+        const auto newPackage = AssetDatabase::GetPackageName(newPath);
+        if (oldPackage != newPackage)
+        {
+            _AssetRegistry[oldPackage].AssetPathMapping.erase(handle);
+        }
+        _AssetRegistry[newPackage].AssetPathMapping[handle] = newPath;
+
+        _AssetIds.erase(it->second);
+        _AssetIds[newPath] = handle;
+        it->second = newPath;
+    }
+
     static void _Scan(std::shared_ptr<AssetFileNode> node, const std::function<void(std::shared_ptr<AssetFileNode>)>& proc)
     {
         for (auto& i : std::filesystem::directory_iterator(node->PhysicsPath))
@@ -144,13 +203,10 @@ namespace pulsared
 
     RCPtr<AssetObject> AssetDatabase::LoadAssetById(ObjectHandle id)
     {
-        for (auto& [packageName, registry] : _AssetRegistry)
+        auto it = _AssetPaths.find(id);
+        if (it != _AssetPaths.end())
         {
-            auto it = registry.AssetPathMapping.find(id);
-            if (it != registry.AssetPathMapping.end())
-            {
-                return LoadAssetAtPath(it->second);
-            }
+            return LoadAssetAtPath(it->second);
         }
         return nullptr;
     }
@@ -164,15 +220,11 @@ namespace pulsared
 
     string AssetDatabase::GetPathById(ObjectHandle id)
     {
-        for (auto& [package, registry] : _AssetRegistry)
+        auto it = _AssetPaths.find(id);
+        if (it != _AssetPaths.end())
         {
-            auto it = registry.AssetPathMapping.find(id);
-            if (it != registry.AssetPathMapping.end())
-            {
-                return it->second;
-            }
+            return it->second;
         }
-
         return {};
     }
     string AssetDatabase::GetPathByAsset(const RCPtr<AssetObject>& asset)
@@ -182,13 +234,10 @@ namespace pulsared
 
     ObjectHandle AssetDatabase::GetIdByPath(string_view path)
     {
-        for (auto& [package, registry] : _AssetRegistry)
+        auto it = _AssetIds.find(string{path});
+        if (it != _AssetIds.end())
         {
-            for (auto& [k, v] : registry.AssetPathMapping)
-            {
-                if (v == path)
-                    return k;
-            }
+            return it->second;
         }
         return {};
     }
@@ -210,6 +259,7 @@ namespace pulsared
         {
             _DirtyObjects.erase(it);
         }
+        _DirtyHandles.erase(asset.GetHandle());
     }
 
     bool AssetDatabase::ExistsAsset(const RCPtr<AssetObject>& asset)
@@ -279,6 +329,38 @@ namespace pulsared
         }
     }
 
+    bool AssetDatabase::CookPackage(string_view packageName, const std::filesystem::path& outPath)
+    {
+        auto it = _AssetRegistry.find(string{packageName});
+        if (it == _AssetRegistry.end())
+        {
+            return false;
+        }
+
+        CookedAssetPackageWriter writer;
+        for (auto& [handle, path] : it->second.AssetPathMapping)
+        {
+            auto asset = LoadAssetAtPath(path);
+            if (!asset)
+            {
+                Logger::Log("cook failed to load asset: " + path, LogLevel::Error);
+                continue;
+            }
+            writer.AddAsset(asset.GetPtr(), path);
+        }
+
+        std::filesystem::create_directories(outPath.parent_path());
+        auto fs = std::ofstream{outPath, std::ios::out | std::ios::trunc | std::ios::binary};
+        if (!fs.is_open())
+        {
+            return false;
+        }
+        writer.Write(fs);
+
+        Logger::Log("cooked package " + string{packageName} + ": " + std::to_string(writer.GetAssetCount()) + " assets");
+        return true;
+    }
+
     void AssetDatabase::NewAsset(string_view folderPath, string_view assetName, Type* assetType)
     {
         Logger::Log("new asset : " + string{folderPath} + " ; " + string{assetName});
@@ -333,7 +415,7 @@ namespace pulsared
         }
 
         _WriteAssetToDisk(FileTree, path, asset);
-        _AssetRegistry[GetPackageName(path)].AssetPathMapping[asset->GetObjectHandle()] = path;
+        _RegisterAsset(asset->GetObjectHandle(), string{path}, asset->GetType()->GetName());
 
         MarkDirty(asset);
 
@@ -371,7 +453,6 @@ namespace pulsared
 
         for (const auto& node : nodes)
         {
-            string packageName = node->GetPackageName();
             string assetPath = node->AssetPath;
 
             OnDeletedAsset.Invoke(assetPath);
@@ -390,8 +471,7 @@ namespace pulsared
             }
 
             // unregister registry
-            auto assetId = GetIdByPath(assetPath);
-            _AssetRegistry.at(packageName).AssetPathMapping.erase(assetId);
+            _UnregisterAsset(handle);
 
             // delete physic file
             for (auto& removePath : _GetClusterPhysicPath(physicPath))
@@ -462,9 +542,62 @@ namespace pulsared
             _FindAssets(paths, child.get(), filter);
         }
     }
+    static bool _FilterAsset(AssetFileNode* node, const AssetFilter& filter)
+    {
+        if (!filter.WhiteList.empty())
+        {
+            return std::ranges::contains(filter.WhiteList, node->GetAssetType());
+        }
+        if (!filter.BlackList.empty())
+        {
+            return !std::ranges::contains(filter.BlackList, node->GetAssetType());
+        }
+        return true;
+    }
     array_list<string> AssetDatabase::FindAssets(const AssetFilter& filter)
     {
         array_list<string> ret;
+        if (!filter.FolderPath.empty())
+        {
+            // only the direct children of the folder can match
+            if (auto folder = FileTree->Find(filter.FolderPath))
+            {
+                for (const auto& child : folder->GetChildren())
+                {
+                    if (_FilterAsset(child.get(), filter))
+                    {
+                        ret.push_back(child->AssetPath);
+                    }
+                }
+            }
+            return ret;
+        }
+
+        const auto folderType = cltypeof<FolderAsset>();
+        if (!filter.WhiteList.empty() && !std::ranges::contains(filter.WhiteList, folderType))
+        {
+            for (auto typeIt = filter.WhiteList.begin(); typeIt != filter.WhiteList.end(); ++typeIt)
+            {
+                const auto type = *typeIt;
+                // the white list may repeat a type
+                if (!type || std::find(filter.WhiteList.begin(), typeIt, type) != typeIt)
+                {
+                    continue;
+                }
+                auto it = _TypeAssets.find(type->GetName());
+                if (it == _TypeAssets.end())
+                {
+                    continue;
+                }
+                for (const auto& handle : it->second)
+                {
+                    ret.push_back(_AssetPaths.at(handle));
+                }
+            }
+            std::ranges::sort(ret);
+            return ret;
+        }
+
         for (const auto& package : FileTree->GetChildren())
         {
             _FindAssets(ret, package.get(), filter);
@@ -539,8 +672,7 @@ namespace pulsared
         node-> SetAssetPath(dstAsset);
         dstFolderNode->AddChild(node);
 
-        auto packageName = AssetDatabase::GetPackageName(srcAsset);
-        _AssetRegistry.at(packageName).AssetPathMapping.at(node->AssetMeta->Handle) = dstAsset;
+        _MoveAsset(node->AssetMeta->Handle, string{dstAsset});
 
 
         return true;
@@ -569,6 +701,7 @@ namespace pulsared
     void AssetDatabase::MarkDirty(const RCPtr<AssetObject>& asset) noexcept
     {
         _DirtyObjects.insert(asset);
+        _DirtyHandles.insert(asset.GetHandle());
     }
 
     bool AssetDatabase::IsDirty(const RCPtr<AssetObject>& asset) noexcept
@@ -577,7 +710,7 @@ namespace pulsared
     }
     bool AssetDatabase::IsDirtyHandle(const ObjectHandle& asset) noexcept
     {
-        return std::ranges::any_of(_DirtyObjects, [asset](auto& obj) { return obj.Handle == asset; });
+        return _DirtyHandles.contains(asset);
     }
 
     Type* AssetFileNode::GetAssetType() const
@@ -620,7 +753,11 @@ namespace pulsared
         RuntimeObjectManager::OnPostEditChanged -= _OnPostEditChanged;
         IconPool.reset();
         decltype(_DirtyObjects){}.swap(_DirtyObjects);
+        decltype(_DirtyHandles){}.swap(_DirtyHandles);
         decltype(_AssetRegistry){}.swap(_AssetRegistry);
+        decltype(_AssetPaths){}.swap(_AssetPaths);
+        decltype(_AssetIds){}.swap(_AssetIds);
+        decltype(_TypeAssets){}.swap(_TypeAssets);
     }
 
     void AssetDatabase::Refresh()
@@ -747,13 +884,7 @@ namespace pulsared
             {
                 if (node->IsFolder)
                     return;
-                string packageName = node->GetPackageName();
-                auto it = _AssetRegistry.find(packageName);
-                if (it == _AssetRegistry.end())
-                {
-                    _AssetRegistry.insert({packageName, {}});
-                }
-                _AssetRegistry[packageName].AssetPathMapping[node->AssetMeta->Handle] = node->AssetPath;
+                _RegisterAsset(node->AssetMeta->Handle, node->AssetPath, node->AssetMeta->Type);
             }
         });
 
@@ -184,6 +184,7 @@ namespace pulsared
 
         StringUtil::strcpy(config->ProgramName, "Pulsar");
         StringUtil::strcpy(config->Title, "Pulsar Editor v0.2 - Vulkan1.3");
+        StringUtil::strcpy(config->PipelineCachePath, (AppRootDir() / "pipelinecache.bin").string());
 
         Logger::Log("pre intialized");
     }
@@ -268,6 +269,9 @@ namespace pulsared
             "Engine/Shaders/Lambert",
             "Engine/Shaders/Unlit",
             "Engine/Shaders/VertexColor",
+            "Engine/Shaders/Lit",
+            "Engine/Shaders/Toon",
+            "Engine/Shaders/SkySphere",
         };
         if (PreCompileShaderPaths.empty())
         {
@@ -395,6 +399,8 @@ namespace pulsared
 
         uinput::InputManager::GetInstance()->ProcessEvents();
 
+        m_assetManager->Tick();
+
         EditorWorld::GetPreviewWorld()->Tick(dt);
         //World::Current()->Tick(dt);
 
@@ -18,11 +18,11 @@ namespace pulsared
 
         void OnRender(gfx::GFXRenderContext* context, gfx::GFXFrameBufferObject* backbuffer) override
         {
-            auto& cmd = context->AddCommandBuffer();
-            cmd.Begin();
             base::OnRender(context, backbuffer);
 
-            // render editor ui
+            // render editor ui, submitted after the camera command buffers
+            auto& cmd = context->AddCommandBuffer();
+            cmd.Begin();
 
             for (auto world : m_worlds)
             {
@@ -5,6 +5,7 @@
 #include "Menus/Menu.h"
 #include "Menus/MenuEntrySubMenu.h"
 #include "Pulsar/AssetManager.h"
+#include "Pulsar/CookedAssetPackage.h"
 #include "Pulsar/Components/BoxShape3DComponent.h"
 #include "Pulsar/Components/DirectionalLightComponent.h"
 #include "Pulsar/Components/PointLightComponent.h"
@@ -40,6 +41,17 @@ namespace pulsared
                 Workspace::OpenDialogUserWorkspace();
             });
             file->AddEntry(openWorkSpace);
+
+            auto cook = mksptr(new MenuEntryButton("Cook Packages"));
+            cook->Action = MenuAction::FromLambda([](MenuContexts_rsp) {
+                AssetDatabase::SaveAll();
+                for (auto& package : AssetDatabase::GetPackageInfos())
+                {
+                    const auto outPath = std::filesystem::path{Workspace::LibraryPath()} / "Cooked" / (package.Name + kCookedPackageExt);
+                    AssetDatabase::CookPackage(package.Name, outPath);
+                }
+            });
+            file->AddEntry(cook);
         }
         {
             MenuEntrySubMenu_sp menu = mksptr(new MenuEntrySubMenu("Edit"));
@@ -110,7 +110,7 @@ namespace pulsared
             {
                 auto componentGuid = comp->GetObjectHandle().to_string();
                 Type* componentType = comp->GetType();
-                auto fields = componentType->GetFieldInfos(TypeBinding::NonPublic);
+                const auto& fields = componentType->GetFieldInfos(TypeBinding::NonPublic);
 
                 PImGui::ObjectFieldProperties(
                     comp->GetType(),
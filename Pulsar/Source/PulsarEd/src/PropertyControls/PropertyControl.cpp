@@ -173,7 +173,7 @@ namespace pulsared
 
             if (opened)
             {
-                const auto fieldInfos = innerType->GetFieldInfos(TypeBinding::NonPublic);
+                const auto& fieldInfos = innerType->GetFieldInfos(TypeBinding::NonPublic);
                 for (size_t i = 0; i < fieldInfos.size(); ++i)
                 {
                     const auto& field = fieldInfos[i];
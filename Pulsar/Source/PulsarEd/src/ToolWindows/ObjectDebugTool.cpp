@@ -17,6 +17,8 @@ namespace pulsared
         size_t total, pending, alive;
         RuntimeObjectManager::GetData(&total, &pending, &alive);
         ImGui::Text("Total Obejct: %d, Pending Kill: %d, Alive: %d", (int)total, (int)pending, (int)alive);
+        const auto gcStats = RuntimeObjectManager::GetGCollectStats();
+        ImGui::Text("GC Backlog: %d, Processed: %d, Time: %dus", (int)gcStats.Backlog, (int)gcStats.Processed, (int)gcStats.TimeMicroseconds);
 
         ImGui::BeginTable("tab", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable);
         ImGui::TableSetupColumn("Object Name");
@@ -24,7 +26,7 @@ namespace pulsared
         ImGui::TableSetupColumn("Object Handle");
         ImGui::TableSetupColumn("Persistent Path");
         ImGui::TableSetupColumn("RCCounter");
-        ImGui::TableSetupColumn("PtrUseCounter");
+        ImGui::TableSetupColumn("Generation");
         ImGui::TableHeadersRow();
 
         RuntimeObjectManager::ForEachObject([](auto& info) {
@@ -43,10 +45,10 @@ namespace pulsared
             ImGui::Text(AssetDatabase::GetPathById(info.Handle).c_str());
 
             ImGui::TableSetColumnIndex(4);
-            ImGui::Text(std::to_string(RuntimeObjectManager::GetPointer(info.Handle)->RefCount()).c_str());
+            ImGui::Text(std::to_string(info.RefCount).c_str());
 
             ImGui::TableSetColumnIndex(5);
-            ImGui::Text(std::to_string(info.ManagedCounter).c_str());
+            ImGui::Text(std::to_string(info.Generation).c_str());
         });
         ImGui::EndTable();
     }